@@ -15,11 +15,220 @@
 #include <algorithm> // For std::min, std::max (if needed, ensure not for containers)
 #include <cstdio>    // For C-style I/O (e.g., printf, scanf, FILE ops from Task 2)
 #include <cctype>    // For character functions (e.g., tolower, isdigit from Task 2)
+#include <cstdint>   // For fixed-width column types (Task 4 match table)
+#include <charconv>  // For std::to_chars (BufferedWriter)
+#include <atomic>    // For the instrumentation counters
+#include <chrono>    // For ScopedTimer
+#include <cstddef>   // For std::max_align_t (MemoryTracker arrays)
+#include <new>       // For std::bad_alloc and placement new (MemoryTracker)
+#include <type_traits>
+#include <thread>    // For the Task 2 check-in applier thread
 
 // Forward declarations if strictly necessary, but full declarations preferred in H for this structure.
 
 // Common Constants
 const int TASK4_MAX_CAPACITY = 100; // Used by Task 4
+const int TASK4_MAX_CODES = 32;     // Distinct stage/status names in the Task 4 match table
+const char* const TASK1_CHECKPOINT_FILE = "tournament_state.chk"; // Task 1 crash recovery (Tournament::openJournal)
+const char* const TASK1_JOURNAL_FILE = "tournament_events.log";
+const char* const TASK2_CHECKIN_LOG = "checkin_events.log"; // Check-ins the Task 2 desk has not saved to the CSV yet
+
+// Shared file output for CSV, JSON Lines and binary exports (Tasks 1, 2 and 4).
+// Text is formatted straight into one large buffer (integers via std::to_chars)
+// and each flush hands the whole buffer to the OS in a single unbuffered write.
+class BufferedWriter {
+public:
+    explicit BufferedWriter(size_t buffer_bytes = 1 << 20);
+    ~BufferedWriter(); // Closes the file if still open
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    bool open(const char* path, bool append = false); // Truncates unless appending
+    // Writes to path + ".tmp"; close() syncs it to disk and renames it over path,
+    // so a crash leaves either the old file or the new one, never half of each.
+    bool openReplace(const char* path);
+    bool close();                // Flushes; false if any write failed (a replace then leaves path untouched)
+    bool sync();                 // Flushes and waits until the bytes are on disk
+    bool isOpen() const;
+    bool flush();
+    long long bytesWritten() const; // Including bytes still buffered
+
+    void put(char c);
+    void write(const void* data, size_t n);
+    void write(const char* s);
+    void write(const std::string& s);
+    void writeInt(long long value);
+    void writeFixed(double value, int decimals); // e.g. 66.67 for (66.666, 2); decimals 0..6; NaN, infinities and values past ±9e18 write 0
+    void writeCsvField(const char* s);    // Task 2 rows only: commas become ';' and non-printable bytes are dropped
+    void writeCsvQuoted(const char* s);   // RFC 4180: quoted only when it holds ',', '"' or a line break; UTF-8 kept
+    void writeJsonString(const char* s);  // Quoted and escaped
+
+private:
+    void reserve(size_t n); // Flushes first when n more bytes would not fit
+    FILE* file;
+    char* buffer;
+    size_t capacity;
+    size_t used;
+    long long flushed;
+    bool failed;
+    std::string replaceTarget; // Set by openReplace
+};
+
+// Hot-path instrumentation: latency histograms per operation plus process-wide
+// allocation and write counters. Built in when APUEC_INSTRUMENT is 1 (the CMake
+// default for every configuration except Release); otherwise the APUEC_ macros
+// below expand to nothing and operator new is left alone.
+#ifndef APUEC_INSTRUMENT
+#ifdef NDEBUG
+#define APUEC_INSTRUMENT 0
+#else
+#define APUEC_INSTRUMENT 1
+#endif
+#endif
+
+// HDR-style log-linear histogram of nanosecond latencies. Values below 64 are exact;
+// above that every power of two is split into 32 buckets, so a reported percentile
+// is within 1/32 (about 3%) of the recorded value. Recording is lock-free.
+class LatencyHistogram {
+public:
+    static const int SUB_BUCKETS = 32;
+    static const int BUCKETS = 2 * SUB_BUCKETS + 58 * SUB_BUCKETS; // covers the full uint64_t range
+
+    LatencyHistogram();
+    void record(uint64_t nanoseconds);
+    void reset();
+    uint64_t count() const;
+    uint64_t min() const;
+    uint64_t max() const;
+    double mean() const;
+    uint64_t percentile(double p) const; // p in 0..100; highest value equivalent to the bucket holding it
+
+private:
+    static int bucketOf(uint64_t value);
+    static uint64_t bucketHighest(int bucket);
+    std::atomic<uint64_t> counts[BUCKETS];
+    std::atomic<uint64_t> total;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> lowest;
+    std::atomic<uint64_t> highest;
+};
+
+// Process-wide registry. Histograms are registered by name on first use and live
+// for the whole run; names must be string literals.
+class Instrumentation {
+public:
+    static const int MAX_OPERATIONS = 32;
+
+    static LatencyHistogram* histogram(const char* operation);
+    static void countAllocation(size_t bytes);
+    static void countFree();
+    static void addBytesWritten(long long bytes);
+    static void printReport(std::ostream& out);    // Admin menu table
+    static bool writeJSON(const char* path);        // Machine-readable dump, written at exit
+    static void reset();
+};
+
+// Times the enclosing scope into one histogram.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(LatencyHistogram* histogram);
+    ~ScopedTimer();
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+private:
+    LatencyHistogram* histogram;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define APUEC_CONCAT_INNER(a, b) a##b
+#define APUEC_CONCAT(a, b) APUEC_CONCAT_INNER(a, b)
+#if APUEC_INSTRUMENT
+// The histogram lookup happens once per call site; each pass only reads the clock twice.
+#define APUEC_SCOPED_TIMER(operation)                                                                     \
+    static LatencyHistogram* const APUEC_CONCAT(apuec_histogram_, __LINE__) = Instrumentation::histogram(operation); \
+    ScopedTimer APUEC_CONCAT(apuec_timer_, __LINE__)(APUEC_CONCAT(apuec_histogram_, __LINE__))
+#define APUEC_COUNT_BYTES_WRITTEN(bytes) Instrumentation::addBytesWritten(bytes)
+#else
+#define APUEC_SCOPED_TIMER(operation) ((void)0)
+#define APUEC_COUNT_BYTES_WRITTEN(bytes) ((void)0)
+#endif
+
+// Memory accounting per subsystem. Every long-lived structure allocates through
+// MemoryTracker with its subsystem's tag, so live and peak bytes can be reported per
+// subsystem next to the process RSS. Always built in: one relaxed add per call.
+enum MemoryTag {
+    MEMORY_TASK1_PLAYERS,       // Player objects, the check-in queue and player arrays
+    MEMORY_TASK1_MATCHES,       // Match and Group objects, the match queue and arrays
+    MEMORY_TASK2_REGISTRATIONS, // Task2_Player records
+    MEMORY_TASK3_QUEUES,        // Spectators, match lists, seating/stream queues, watch history
+    MEMORY_TASK4_HISTORY,       // Match table, indexes, leaderboard, head-to-head, snapshot
+    MEMORY_TAG_COUNT
+};
+
+class MemoryTracker {
+public:
+    // malloc-like: nullptr on failure. release() must get the same size and tag.
+    static void* allocate(size_t bytes, MemoryTag tag);
+    static void release(void* block, size_t bytes, MemoryTag tag);
+
+    // Arrays of trivially destructible T; the size is kept in a small header so
+    // releaseArray() needs only the pointer. Throws std::bad_alloc like new[].
+    template <typename T> static T* allocateArray(size_t count, MemoryTag tag);
+    template <typename T> static void releaseArray(T* array);
+
+    static long long liveBytes(MemoryTag tag);
+    static long long liveBlocks(MemoryTag tag);
+    static long long peakBytes(MemoryTag tag);
+    static long long totalAllocations(MemoryTag tag);
+    static const char* tagName(MemoryTag tag);
+    static long long currentRSS(); // bytes, 0 where the platform does not say
+    static long long peakRSS();
+
+    static void printReport(std::ostream& out); // Admin menu breakdown
+    static void reportLeaksAtExit();            // Prints what is still allocated once main() has returned
+
+private:
+    struct ArrayHeader {
+        size_t bytes;
+        MemoryTag tag;
+    };
+    // Header size rounded up so the elements keep malloc's alignment
+    static const size_t ARRAY_HEADER = (sizeof(ArrayHeader) + alignof(std::max_align_t) - 1)
+                                       / alignof(std::max_align_t) * alignof(std::max_align_t);
+};
+
+template <typename T>
+T* MemoryTracker::allocateArray(size_t count, MemoryTag tag) {
+    static_assert(std::is_trivially_destructible<T>::value, "allocateArray is for trivially destructible types");
+    size_t bytes = ARRAY_HEADER + sizeof(T) * (count > 0 ? count : 1);
+    unsigned char* block = (unsigned char*)allocate(bytes, tag);
+    if (!block) throw std::bad_alloc();
+    ArrayHeader* header = (ArrayHeader*)block;
+    header->bytes = bytes;
+    header->tag = tag;
+    T* array = (T*)(block + ARRAY_HEADER);
+    for (size_t i = 0; i < count; i++) new (array + i) T; // default-initialised, as new T[count] would be
+    return array;
+}
+
+template <typename T>
+void MemoryTracker::releaseArray(T* array) {
+    if (!array) return;
+    ArrayHeader* header = (ArrayHeader*)((unsigned char*)array - ARRAY_HEADER);
+    release(header, header->bytes, header->tag);
+}
+
+// Inside a class body: routes new/delete (and the array forms) of the class through
+// MemoryTracker under the given tag. Leaves the access level at public.
+#define APUEC_MEMORY_TAG(tag)                                                                       \
+public:                                                                                             \
+    static void* operator new(size_t bytes) {                                                      \
+        if (void* block = MemoryTracker::allocate(bytes, tag)) return block;                       \
+        throw std::bad_alloc();                                                                     \
+    }                                                                                               \
+    static void* operator new[](size_t bytes) { return operator new(bytes); }                      \
+    static void operator delete(void* block, size_t bytes) { MemoryTracker::release(block, bytes, tag); } \
+    static void operator delete[](void* block, size_t bytes) { MemoryTracker::release(block, bytes, tag); }
 
 // Task 1: Match Scheduling - Class Declarations
 class Player; // Forward declaration for Match, Group, PlayerPriorityQueue
@@ -31,7 +240,7 @@ class PlayerPriorityQueue;
 
 
 class Player {
-public:
+    APUEC_MEMORY_TAG(MEMORY_TASK1_PLAYERS)
     Player(int _id, const char* _name, const char* _rank, const char* _registrationType, int _ranking,
            const char* _email, int _teamID, bool _checkInStatus);
     int getId() const;
@@ -65,6 +274,7 @@ private:
     bool registered;
     bool checkedIn;
     char checkInTime[20]; // Format: YYYY-MM-DD HH:MM
+    friend class Tournament; // Restores checkpointed players field by field
 };
 
 class MatchQueue {
@@ -73,10 +283,14 @@ public:
     ~MatchQueue();
     void enqueue(Match* match);
     Match* dequeue();
+    Match* peek() const; // Front match without removing it, nullptr if empty
+    bool remove(Match* match); // Unlinks the match wherever it is queued
+    int copyTo(Match** out, int max) const; // Front to back, without dequeuing; returns how many
     bool isEmpty() const;
     int getSize() const;
 private:
     struct Node {
+        APUEC_MEMORY_TAG(MEMORY_TASK1_MATCHES)
         Match* match;
         Node* next;
         Node(Match* m);
@@ -95,17 +309,19 @@ public:
     int getSize() const;
 private:
     struct Node {
+        APUEC_MEMORY_TAG(MEMORY_TASK1_PLAYERS)
         Player* player;
         Node* next;
         Node(Player* p);
     };
     Node* head;
+    Node* tail; // Players loaded in check-in order are appended here without a walk
     int size;
     bool isEarlier(const char* time1, const char* time2); // Compares "YYYY-MM-DD HH:MM"
 };
 
 class Match {
-public:
+    APUEC_MEMORY_TAG(MEMORY_TASK1_MATCHES)
     Match(int _id, Player* p1, Player* p2, const char* _stage, int _groupId, int _round);
     int getId() const;
     Player* getPlayer1() const;
@@ -130,10 +346,11 @@ private:
     Player* winner;
     char score[10];
     char scheduledTime[20];
+    friend class Tournament; // Restores checkpointed matches field by field
 };
 
 class Group {
-public:
+    APUEC_MEMORY_TAG(MEMORY_TASK1_MATCHES)
     Group(int _id, const char* _rankType, const char* _registrationType);
     ~Group();
     int getId() const;
@@ -167,11 +384,96 @@ private:
     Player* winner;
     bool completed;
     int semiFinalsCompleted; // Counter for completed semifinal matches
+    friend class Tournament; // Restores checkpointed groups field by field
+};
+
+// Called by Tournament::updateMatchResult once a match has its winner.
+typedef void (*MatchCompletedCallback)(const Match* match, void* context);
+
+// Immutable copy of the tournament taken after every change, so status displays and
+// queries can read groups, brackets and the upcoming queue while results are applied.
+// Players, matches and groups refer to each other by index into the snapshot's own
+// arrays (-1 for none).
+struct TournamentSnapshotPlayer {
+    int id;
+    char name[100];
+    char rank[2];
+    char currentStage[20];
+    int groupId;
+    bool checkedIn;
+};
+
+struct TournamentSnapshotMatch {
+    int id;
+    char stage[20];
+    int groupId;
+    int round;
+    int player1, player2, winner; // indices into players
+    char status[20];
+    char score[20];
+    char scheduledTime[20];
+};
+
+struct TournamentSnapshotGroup {
+    int id;
+    char rankType[2];
+    char registrationType[30];
+    int players[4];
+    int playerCount;
+    int matches[3]; // indices into matches
+    int matchCount;
+    int winner;
+    bool completed;
+};
+
+class TournamentSnapshot {
+    APUEC_MEMORY_TAG(MEMORY_TASK1_MATCHES)
+    TournamentSnapshot(int _playerCount, int _matchCount, int _groupCount, int _upcomingCount, int _groupWinnerCount);
+    ~TournamentSnapshot();
+    TournamentSnapshot(const TournamentSnapshot&) = delete;
+    TournamentSnapshot& operator=(const TournamentSnapshot&) = delete;
+
+    const TournamentSnapshotPlayer* player(int index) const; // nullptr for -1
+    const TournamentSnapshotMatch* findMatch(int matchId) const;
+    int completedMatchCount() const;
+    const char* stageDescription() const; // e.g. "Group Stage In Progress"
+    void print(std::ostream& out) const;  // The Task 1 tournament status display
+
+    long long version; // Increases with every publish
+    bool groupsCreated;
+    bool groupSemifinalsCreated;
+    bool knockoutCreated;
+    int totalMatchesPlayed;
+    int playerCount, matchCount, groupCount, upcomingCount, groupWinnerCount;
+    TournamentSnapshotPlayer* players;
+    TournamentSnapshotMatch* matches;
+    TournamentSnapshotGroup* groups;
+    int* upcoming;     // match indices in queue order
+    int* groupWinners; // player indices
+
+private:
+    friend class Tournament;
+    TournamentSnapshot* nextRetired; // Writer-side list of replaced snapshots
+};
+
+// Pins the tournament's current snapshot for as long as it lives. Readers take no
+// lock: each pin is a hazard pointer the writer checks before freeing an old snapshot.
+class TournamentSnapshotRef {
+public:
+    explicit TournamentSnapshotRef(const Tournament& tournament);
+    ~TournamentSnapshotRef();
+    TournamentSnapshotRef(const TournamentSnapshotRef&) = delete;
+    TournamentSnapshotRef& operator=(const TournamentSnapshotRef&) = delete;
+    const TournamentSnapshot* operator->() const { return snapshot; }
+    const TournamentSnapshot& operator*() const { return *snapshot; }
+private:
+    std::atomic<const TournamentSnapshot*>* slot;
+    const TournamentSnapshot* snapshot;
 };
 
 class Tournament {
 public:
-    Tournament(int _maxPlayers = 100, int _maxMatches = 200, int _maxGroupWinners = 20);
+    Tournament(int _maxPlayers = 100, int _maxMatches = 200, int _maxGroupWinners = 20, int _maxGroups = 10);
     ~Tournament();
 
     void initialize(const char* playerFilename); // Loads players, groups them by rank from check-in queue
@@ -179,18 +481,55 @@ public:
     void createGroupSemifinals(); // Creates semifinal matches for all valid groups
     Match* getNextMatch(); // Gets next match from upcomingMatches queue
     void updateMatchResult(Match* match, Player* winner); // Updates match, advances stages
-    void displayStatus(); // Displays overall tournament status, group status, upcoming matches
+    void displayStatus() const; // Prints the current snapshot: overall status, groups, upcoming matches
     void runCLI_TASK1(); // Runs the command-line interface for Task 1
     bool areGroupsCreated() const;
+    int getMatchCount() const;
+    Match* getMatch(int index) const; // Live match objects, read by Task 3
+    Match* findMatch(int matchId) const; // nullptr when unknown
+    // Records a result by IDs, in any order (service mode). On failure *error says why.
+    bool submitResult(int matchId, int winnerId, const char** error);
+    void setMatchCompletedListener(MatchCompletedCallback callback, void* context); // nullptr to unsubscribe
+    // Registrations, check-ins and withdrawals that arrive after start-up (service mode). addPlayer
+    // is false when the ID is already known or the tournament is full; checkInPlayer when the ID is
+    // unknown or already checked in. withdrawPlayer drops the player, re-forming its group, and fails
+    // once matches are scheduled (*error says why). regroup re-forms the groups from every
+    // checked-in player while no match exists yet and returns the group count.
+    bool addPlayer(int id, const char* name, const char* rank, const char* registrationType);
+    bool checkInPlayer(int id, const char* time);
+    bool withdrawPlayer(int id, const char** error);
+    int regroup();
+    // addPlayer, checkInPlayer and withdrawPlayer leave the snapshot as it was, so a burst of them
+    // costs one copy of the tournament: readers see them after this (or the next result/schedule).
+    void publishPendingChanges();
 
+    // Crash safety. Call before initialize(): from then on every change is appended to
+    // logPath (synced to disk per event unless syncEachEvent is false) and the whole
+    // tournament is checkpointed to checkpointPath every checkpointEvery events. If a
+    // checkpoint exists, the tournament is restored from it and the log replayed on top,
+    // and openJournal returns true; initialize() is then not needed.
+    bool openJournal(const char* checkpointPath, const char* logPath, int checkpointEvery = 64, bool syncEachEvent = true);
+    bool writeCheckpoint(); // Checkpoints now and starts an empty log; false if the checkpoint could not be written
+    // One log line as openJournal replays it: sequence, event type, two arguments, time, checksum.
+    static void writeJournalEvent(BufferedWriter& out, long long sequence, char type, int a, int b, long long at);
 
 private:
     void loadPlayersFromCSV(const char* filename);
     void groupPlayersByRank(); // Groups checked-in players by rank and registration type
+    void formGroups(); // Drops the groups and groups every checked-in player again
     void saveMatchesToCSV(const char* filename); // Saves all tournament matches
     void saveBracketsToCSV(const char* filename); // Saves player progression (basic bracket info)
     void createKnockoutMatches(); // Creates knockout matches from group winners
     void createFinalMatch(Player* finalist1, Player* finalist2); // Creates the grand final match
+    void publishSnapshot(); // Copies the current state into a new snapshot for readers
+    void reclaimSnapshots(); // Frees replaced snapshots no reader has pinned
+    void discardState(); // Frees every player, match and group (destructor, failed restore)
+    void journalEvent(char type, int a = 0, int b = 0); // Appends one event; checkpoints when due
+    bool restoreCheckpoint(const char* path);
+    bool restoreFromText(char* text, char* end); // Parses a checkpoint in place
+    bool resumeFromCSV(const char* matchesFile, const char* bracketsFile); // After loadPlayersFromCSV; false leaves nothing built
+    long long replayJournal(const char* path); // Returns the number of events applied
+    bool applyJournalEvent(char type, int a, int b);
 
     Player** players; // Array of all player objects
     int playerCount;
@@ -200,6 +539,8 @@ private:
     int maxMatches;
     Group** groups; // Array of group objects
     int groupCount;
+    int maxGroups;
+    int completedGroupCount; // Groups with a winner, so a group final need not scan every group
     Player** groupWinners; // Array of players who won their groups
     int groupWinnerCount;
     int maxGroupWinners;
@@ -212,6 +553,30 @@ private:
     bool groupSemifinalsCreated;
     bool knockoutCreated;
     bool groupsCreated; // Flag to check if initial grouping is done
+
+    MatchCompletedCallback matchCompletedCallback;
+    void* matchCompletedContext;
+
+    // Snapshots: one writer (the thread changing the tournament), any number of readers.
+    friend class TournamentSnapshotRef;
+    static const int SNAPSHOT_READER_SLOTS = 64; // Readers pinning at once; more wait for a slot
+    std::atomic<const TournamentSnapshot*> publishedSnapshot;
+    mutable std::atomic<const TournamentSnapshot*> snapshotPins[SNAPSHOT_READER_SLOTS];
+    TournamentSnapshot* retiredSnapshots;
+    long long snapshotVersion;
+    bool snapshotStale; // Changed since the last publishSnapshot (see publishPendingChanges)
+
+    // Journal (see openJournal). Events: S semifinals created, N match dequeued,
+    // U match unqueued for a result by ID, R result (match ID, winning side 1 or 2),
+    // K knockout created by the admin.
+    BufferedWriter* journal; // nullptr until openJournal
+    std::string checkpointPath;
+    std::string journalPath;
+    long long journalSequence; // Last event logged, or applied during replay
+    int eventsSinceCheckpoint;
+    int checkpointInterval;
+    bool journalSyncEachEvent;
+    bool replaying; // Applying logged events: no CSV saves, snapshots, listener calls or new log entries
 };
 
 
@@ -268,17 +633,416 @@ struct Task2_PriorityQueue {
 
 // Task 2 Function Prototypes (to be called from the integrated system)
 void Task2_runPlayerRegistrationSystem(); // Main loop for Task 2
+void Task2_readPlayersFromCSV(struct Task2_PriorityQueue* pq, const char* filename); // Also used by the benchmarks
+bool Task2_writePlayersToCSV(struct Task2_PriorityQueue* pq, const char* filename); // false if the file could not be written
+
+// Registry operations without prompts, shared by the menus and the service mode.
+// They change only the in-memory registry; the caller saves the CSV.
+struct Task2_WithdrawResult {
+    bool found;
+    bool fromWaitlist;
+    char playerName[50];
+    char rank[2];                  // Empty unless the player was on a MAIN list
+    struct Task2_Player* promoted; // Waitlisted player moved up to MAIN, or NULL
+};
+struct Task2_Player* Task2_addPlayer(struct Task2_PriorityQueue* pq, int playerID, const char* name,
+                                     const char* registrationType, const char* email); // NULL if out of memory
+int Task2_highestPlayerID(struct Task2_PriorityQueue* pq); // 1000 when empty
+struct Task2_Player* Task2_checkInByID(struct Task2_PriorityQueue* pq, const char* playerID); // NULL when unknown
+struct Task2_WithdrawResult Task2_withdrawPlayer(struct Task2_PriorityQueue* pq, const char* playerID);
+void Task2_destroyRegistry(struct Task2_PriorityQueue* pq);
+
+// One desk check-in, stamped when the desk scanned it.
+struct Task2_CheckInEvent {
+    char playerID[10];
+    long long at; // time_t
+};
+
+// Bounded lock-free multi-producer single-consumer ring (Vyukov's sequence-number
+// scheme). Any thread may push; only the applier pops. Capacity is rounded up to a
+// power of two.
+class Task2_CheckInRing {
+public:
+    explicit Task2_CheckInRing(size_t capacity);
+    ~Task2_CheckInRing();
+    Task2_CheckInRing(const Task2_CheckInRing&) = delete;
+    Task2_CheckInRing& operator=(const Task2_CheckInRing&) = delete;
+
+    bool push(const Task2_CheckInEvent& event); // false when full
+    bool pop(Task2_CheckInEvent& event);        // consumer only; false when empty
+    size_t capacity() const;
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Task2_CheckInEvent event;
+    };
+    Cell* cells;
+    size_t mask;
+    alignas(64) std::atomic<size_t> tail; // next slot producers claim
+    alignas(64) size_t head;              // next slot the consumer reads
+};
+
+// Check-in ingestion for busy doors: desk threads submit() into the ring and return
+// at once; one applier thread drains it in batches, applies them to the registry and
+// appends each batch to a check-in log with a single write and fsync, so a check-in
+// is durable once its batch is applied (not when submit() returns). The registry CSV
+// is rewritten at most once per csv_interval_ms and on stop(), after which the log is
+// truncated, so the log only holds check-ins the CSV may not have yet.
+// Between start() and stop() the applier owns the registry; nothing else may touch it.
+// The Task 2 menu's check-in desk runs on it; service mode keeps Task2_checkInByID
+// (see service_checkIn).
+class Task2_CheckInPipeline {
+public:
+    static const int BATCH = 512;
+
+    explicit Task2_CheckInPipeline(size_t ring_capacity = 1 << 16, int csv_interval_ms = 1000);
+    ~Task2_CheckInPipeline(); // stop()s if still running
+
+    // Replays log_path (check-ins from a run that never reached stop()) before starting.
+    bool start(struct Task2_PriorityQueue* pq, const char* csv_path, const char* log_path);
+    bool submit(const char* playerID); // Any thread; false if the ring is full or not running
+    void stop();                       // Drains the ring, saves the CSV and truncates the log
+    bool isRunning() const;
+
+    long long applied() const;    // Players newly checked in
+    long long duplicates() const; // Already checked in
+    long long unknown() const;    // Not in the registry
+    long long batches() const;
+
+    // Applies a check-in log to a registry; returns how many players it checked in.
+    static int replayLog(struct Task2_PriorityQueue* pq, const char* log_path);
+    // replayLog, then saves the CSV and removes the log; -1 (log kept) if the CSV could not be saved.
+    // For anything that loads the registry CSV while a desk may have crashed with check-ins unsaved.
+    static int recover(struct Task2_PriorityQueue* pq, const char* csv_path, const char* log_path);
+
+private:
+    void applierLoop();
+    void applyBatch(Task2_CheckInEvent* events, int count, BufferedWriter& log);
+    bool saveCSV(BufferedWriter& log);
+
+    Task2_CheckInRing ring;
+    int csv_interval_ms;
+    struct Task2_PriorityQueue* pq;
+    const char* csv_path;
+    const char* log_path;
+    struct Task2_Player** index; // open addressing on the ID string, built at start()
+    size_t index_mask;
+    std::thread applier;
+    std::atomic<bool> running;
+    std::atomic<bool> stop_requested;
+    std::atomic<int> in_flight; // submit() calls that passed the running check
+    std::atomic<long long> applied_count;
+    std::atomic<long long> duplicate_count;
+    std::atomic<long long> unknown_count;
+    std::atomic<long long> batch_count;
+};
 // Internal Task 2 functions (will be defined in .cpp, not necessarily needed in .h if static or only called by Task2_runPlayerRegistrationSystem)
 // void Task2_registerPlayer(Task2_PriorityQueue* pq, const char* filename);
 // void Task2_checkInPlayer(Task2_PriorityQueue* pq, const char* filename);
 // void Task2_handleWithdrawPlayer(Task2_PriorityQueue* pq, const char* filename); // Renamed from handleWithdrawPlayer
 // void Task2_displayWaitlist(Task2_PriorityQueue* pq);
-// void Task2_readPlayersFromCSV(Task2_PriorityQueue* pq, const char* filename);
-// void Task2_writePlayersToCSV(Task2_PriorityQueue* pq, const char* filename);
 
 
-// Task 3: Spectator Management (Placeholder - No specific structs/classes defined for it yet)
-void runTask3_SpectatorManagement();
+// Task 3: Spectator Management - Class Declarations
+// Everything lives in namespace Task3 so its Match type can coexist with the Task 1 Match.
+namespace Task3 {
+
+class Spectator {
+    APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+    std::string id, name, supportedPlayer, category, day;
+    bool wantsLiveStream;
+    int paymentAmount;
+    bool active; // active in tournament or left
+    int listIndex; // position in SpectatorList, row in WatchHistoryStack
+    Spectator* next;
+
+    Spectator(const std::string& _id, const std::string& _name, bool _wantsLiveStream,
+              const std::string& _supportedPlayer, const std::string& _category, const std::string& _day);
+    void assignPaymentAmount();
+};
+
+class SpectatorList {
+public:
+    SpectatorList();
+    ~SpectatorList();
+    Spectator* getHead() const;
+    int size() const;
+    Spectator* findById(const std::string& id) const;
+    // Register spectator with auto-generated ID, returns generated ID
+    std::string registerSpectator(const std::string& name, bool wantsLiveStream,
+                                  const std::string& supportedPlayer, const std::string& category, const std::string& day);
+    void loadFromCSV(const char* filename); // Sets nextId after the highest ID found
+    void saveToCSV(const char* filename) const;
+    void displaySpectators() const;
+    void displayActiveSpectators(const std::string& roundName) const;
+    void clear();
+private:
+    void append(Spectator* newNode); // Assigns listIndex and links at the tail
+    Spectator* head;
+    int nextId;  // auto-increment ID counter
+    int count;   // number of spectators in the list
+};
+
+// Spectator-side view of a scheduled match (player IDs as strings).
+class Match {
+    APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+    int matchId;
+    std::string team1, team2;
+    std::string scheduledTime;
+    std::string stage;
+    int round;
+    std::string status;
+    std::string winnerId;
+    Match* next;
+
+    Match(int id, const std::string& t1, const std::string& t2, const std::string& sched, const std::string& stg,
+          int rnd, const std::string& sts = "", const std::string& winner = "");
+    explicit Match(const ::Match& live); // Snapshot of a Task 1 match
+};
+
+class MatchList {
+public:
+    MatchList();
+    ~MatchList();
+    Match* getHead() const;
+    int size() const;
+    void loadFromTournament(const Tournament& tournament); // Reads the live Task 1 matches
+    void loadFromCSV(const char* filename); // Fallback when Task 1 has not scheduled anything
+    int printGroupStageRound1Matches(const std::string& day) const; // Returns how many were listed
+    int countMatchesOnDay(const std::string& day) const;
+    int countGroupStageRound1Matches() const; // Over every day
+    Match* getMatchOnDay(const std::string& day, int position) const; // 1-based, as listed
+    void clear();
+private:
+    // Day -> group stage round 1 matches, rebuilt after every load.
+    // Open-addressing table of days; each day owns a contiguous run of dayMatches.
+    struct DayBucket {
+        APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+        std::string day; // "YYYY-MM-DD", empty when the slot is unused
+        int first;       // offset of the day's first match in dayMatches
+        int count;
+    };
+    void append(Match* newNode);
+    void buildDayIndex();
+    void clearDayIndex();
+    int findDay(const std::string& day) const; // Table slot, -1 when absent
+    static unsigned int hashDay(const std::string& day);
+    Match* head;
+    Match* tail;
+    int count;
+    DayBucket* dayTable;
+    int dayTableSize; // power of two
+    Match** dayMatches;
+    int dayMatchCount;
+};
+
+class StringSet {
+public:
+    StringSet();
+    ~StringSet();
+    bool contains(const std::string& s) const;
+    void insert(const std::string& s);
+private:
+    struct Node {
+        APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+        std::string val;
+        Node* next;
+        Node(const std::string& v);
+    };
+    Node* head;
+};
+
+class PrioritySeatingQueue {
+public:
+    PrioritySeatingQueue();
+    ~PrioritySeatingQueue();
+    void enqueue(Spectator* sp);
+    void displayQueue() const;
+private:
+    struct Node {
+        APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+        Spectator* data;
+        Node* next;
+        Node(Spectator* sp);
+    };
+    Node* front;
+    static int getPriority(const std::string& category);
+};
+
+// Per-tier head/tail/count, O(1) enqueue/dequeue, weighted admission across tiers.
+class MultiLevelLiveStreamQueue {
+public:
+    MultiLevelLiveStreamQueue(int cap, int influencerWeight = 3, int vipWeight = 2, int generalWeight = 1);
+    ~MultiLevelLiveStreamQueue();
+    void setWeights(int influencerWeight, int vipWeight, int generalWeight);
+    bool isFull() const;
+    bool isEmpty() const;
+    int getTotalCount() const;
+    bool enqueue(Spectator* sp);
+    Spectator* dequeue(); // Admits next viewer by weighted round-robin
+    void displayQueue() const;
+private:
+    struct Node {
+        APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+        Spectator* data;
+        Node* next;
+        Node(Spectator* sp);
+    };
+    struct Tier {
+        Node* head;
+        Node* tail;
+        int count;
+        int weight;        // share of admissions relative to the other tiers
+        int currentWeight; // running credit used by the weighted round-robin
+        Tier();
+    };
+    enum { INFLUENCER = 0, VIP = 1, GENERAL = 2, TIER_COUNT = 3 };
+    static int tierFor(const std::string& category);
+    int displayGroup(const std::string& label, const Tier& tier, int count) const;
+    Tier tiers[TIER_COUNT];
+    int totalCount;
+    int capacity;
+};
+
+class CircularStreamRotation {
+public:
+    CircularStreamRotation(int cap);
+    ~CircularStreamRotation();
+    bool isFull() const;
+    bool isEmpty() const;
+    void enqueue(Spectator* sp);
+    Spectator* dequeue();
+    void displayQueue() const;
+private:
+    struct Node {
+        APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+        Spectator* data;
+        Node* next;
+        Node(Spectator* sp);
+    };
+    Node* tail;
+    int size;
+    int capacity;
+};
+
+// Last K watch events per spectator, in one arena of spectatorCount * K events.
+struct WatchEvent {
+    int matchId;          // match on stream, 0 when not tied to a match
+    long long startedAt;  // simulated seconds since the stream started
+    int seconds;          // how long the spectator watched
+};
+
+class WatchHistoryStack {
+public:
+    WatchHistoryStack(int spectatorCount, int eventsPerSpectator = 8);
+    ~WatchHistoryStack();
+    WatchHistoryStack(const WatchHistoryStack&) = delete;
+    WatchHistoryStack& operator=(const WatchHistoryStack&) = delete;
+    bool push(Spectator* sp, int matchId, long long startedAt, int seconds); // O(1) amortised, overwrites oldest
+    int countFor(const Spectator* sp) const;
+    bool getFromTop(const Spectator* sp, int i, WatchEvent& out) const; // 0 = most recent
+    void displayFor(const Spectator* sp) const;
+    void display() const;
+private:
+    bool validRow(const Spectator* sp) const;
+    void grow(int minRows); // Doubles the rows until minRows fit, keeping every ring
+    WatchEvent* arena;  // rowCount * perSpectator events
+    int* writePos;      // next slot to write in each ring
+    int* used;          // events stored in each ring (<= perSpectator)
+    Spectator** owners; // spectator owning each row, for display
+    int rowCount;
+    int perSpectator;
+    long long totalPushed;
+};
+
+class WaitingQueue {
+public:
+    WaitingQueue();
+    ~WaitingQueue();
+    WaitingQueue(const WaitingQueue&) = delete;
+    WaitingQueue& operator=(const WaitingQueue&) = delete;
+    bool isEmpty() const;
+    int size() const;
+    void enqueue(Spectator* sp);
+    Spectator* dequeue();
+private:
+    struct Node {
+        APUEC_MEMORY_TAG(MEMORY_TASK3_QUEUES)
+        Spectator* data;
+        Node* next;
+        Node(Spectator* sp);
+    };
+    Node* front;
+    Node* rear;
+    int count;
+};
+
+// Seconds since the start of the stream; never reads the wall clock.
+class SimulatedClock {
+public:
+    SimulatedClock(long long start = 0);
+    long long now() const;
+    void advance(long long seconds);
+private:
+    long long nowSeconds;
+};
+
+// Timer-wheel rotation: fixed-length slots, auto-promotion from the waiting queue.
+class StreamRotationScheduler {
+public:
+    StreamRotationScheduler(int cap, int slotLengthSeconds, SimulatedClock& clk);
+    ~StreamRotationScheduler();
+    StreamRotationScheduler(const StreamRotationScheduler&) = delete;
+    StreamRotationScheduler& operator=(const StreamRotationScheduler&) = delete;
+    void setVerbose(bool on);
+    void setHistory(WatchHistoryStack* h); // Log every finished slot
+    void setStreamMatch(int matchId);
+    int onStreamCount() const;
+    int waitingCount() const;
+    long long expiredCount() const;
+    long long promotedCount() const;
+    long long now() const;
+    void addViewer(Spectator* sp);
+    void advanceTo(long long targetSeconds);
+    void run(long long seconds); // Advances the clock and processes due ticks
+    void displayQueue() const;
+private:
+    struct Slot {
+        Spectator* viewer;
+        long long expiresAt;
+        int prev, next; // links inside a wheel bucket (slot indexes, -1 = none)
+    };
+    void linkIntoBucket(int idx);
+    void startSlot(Spectator* sp);
+    void promoteWaiting();
+    void processTick();
+    Slot* slots;
+    int* freeSlots;   // stack of unused slot indexes
+    int freeCount;
+    int capacity;
+    int* wheel;       // head slot index per bucket, -1 when empty
+    int* wheelTail;   // tail slot index per bucket, keeps expiry order FIFO
+    int wheelSize;
+    int slotSeconds;
+    long long currentTick;
+    long long expiredTotal;
+    long long promotedTotal;
+    bool verbose;
+    int streamMatchId;          // match currently on stream, logged with each slot
+    WatchHistoryStack* history; // optional, receives every finished slot
+    SimulatedClock& clock;
+    WaitingQueue waiting;
+};
+
+void updateSpectatorsByMatchResults(SpectatorList& spectators, MatchList& matches,
+                                    const std::string& stage, int round);
+void simulateQueueManagement(SpectatorList& regList);
+
+} // namespace Task3
+
+// Task 3 entry point; reads matches from the live Task 1 tournament.
+void runTask3_SpectatorManagement(Tournament& tournament);
 
 
 // Task 4: Result Logging - Struct and Class Declarations
@@ -303,6 +1067,9 @@ class Task4_Stack {
 public:
     Task4_Stack();
     bool push(const Task4_MatchResult& match);
+    void pushEvictOldest(const Task4_MatchResult& match); // When full, drops the bottom entry
+    bool replace(const Task4_MatchResult& match); // Overwrites the entry with the same match_id; false if none
+
     bool pop(Task4_MatchResult& out);
     bool peek(Task4_MatchResult& out) const;
     bool getFromTop(int index, Task4_MatchResult& out) const; // Get element by index from top (0 is top)
@@ -310,8 +1077,9 @@ public:
     int size() const;
 
 private:
-    Task4_MatchResult data[TASK4_MAX_CAPACITY];
-    int top_index; // -1 for empty stack
+    Task4_MatchResult data[TASK4_MAX_CAPACITY]; // Ring buffer so the oldest entry can be dropped in O(1)
+    int top_index; // Slot of the top entry
+    int count;
 };
 
 class Task4_Queue { // Circular Queue
@@ -332,6 +1100,7 @@ private:
 };
 
 struct Task4_PlayerStats {
+    APUEC_MEMORY_TAG(MEMORY_TASK4_HISTORY)
     int player_id;
     std::string name;
     std::string rank;
@@ -340,10 +1109,502 @@ struct Task4_PlayerStats {
     int total_matches;
     int wins;
     int losses;
-    double avg_score;
+    long long score_total; // Sum of the player's own scores; averaged only for display
 
     Task4_PlayerStats(); // Default constructor
     Task4_PlayerStats(int pid, const std::string& n, const std::string& r, const std::string& c, const std::string& reg_time);
+    double averageScore() const;
+};
+
+// Per-player totals produced by Task4_MatchTable::aggregatePlayerTotals.
+struct Task4_PlayerTotals {
+    int player_id;
+    int matches; // completed matches with a winner
+    int wins;
+    int losses;
+    long long score_total;
+};
+
+// One calendar day (UTC) of the match table, kept in day order so time-range
+// queries can binary-search to the first relevant day and stop after the last.
+struct Task4_DayBlock {
+    int day;          // days since 1970-01-01
+    int64_t min_time; // earliest / latest scheduled time on this day, epoch seconds
+    int64_t max_time;
+    int rows;
+};
+
+// A player's completed matches on one day block.
+struct Task4_DayRecord {
+    int block; // position in the day directory; block + 1 is the tournament day number
+    int day;
+    int matches;
+    int wins;
+};
+
+// Open-addressing hash map from int keys to int values (linear probing).
+class Task4_IntIndex {
+public:
+    Task4_IntIndex();
+    ~Task4_IntIndex();
+    void clear();
+    bool find(int key, int& value) const;
+    void put(int key, int value); // Inserts or overwrites
+    bool putIfAbsent(int key, int value); // False, keeping the stored value, when key is already there
+    int size() const;
+
+private:
+    void rehash(int new_capacity);
+    int* keys;
+    int* values;
+    unsigned char* used; // 1 when the slot holds a key
+    int capacity;        // power of two, 0 before the first put
+    int count;
+};
+
+// Roaring-style row set: rows are split into 65536-row chunks, each stored as
+// a sorted uint16 array while sparse (<= 4096 rows) or as a 1024-word bitmap
+// when dense. AND/OR work chunk by chunk, with word-wise AND + popcount for
+// bitmap chunks.
+class Task4_Bitmap {
+    APUEC_MEMORY_TAG(MEMORY_TASK4_HISTORY)
+    Task4_Bitmap();
+    ~Task4_Bitmap();
+    Task4_Bitmap(const Task4_Bitmap&) = delete;
+    Task4_Bitmap& operator=(const Task4_Bitmap&) = delete;
+
+    void clear();
+    void add(int row);
+    void remove(int row);
+    void addRange(int first_row, int end_row); // [first_row, end_row)
+    bool contains(int row) const;
+    int cardinality() const;
+    int nextRow(int from_row) const; // First row >= from_row, -1 when none
+    void copyFrom(const Task4_Bitmap& other);
+    void andWith(const Task4_Bitmap& other);
+    void orWith(const Task4_Bitmap& other);
+
+private:
+    struct Container {
+        uint16_t key;      // row >> 16
+        int cardinality;
+        uint16_t* values;  // sorted low halves, when words is null
+        int capacity;
+        uint64_t* words;   // 1024-word bitmap, when the chunk is dense
+    };
+    static const int ARRAY_MAX = 4096;
+    static const int WORDS = 1024;
+    int findContainer(uint16_t key) const; // Index of the first container with key >= key
+    Container& containerAt(uint16_t key);  // Creates the container when missing
+    void insertContainer(int pos, const Container& c);
+    static void freeContainer(Container& c);
+    static void copyContainer(Container& dst, const Container& src);
+    static void addToContainer(Container& c, uint16_t low);
+    static bool containerHas(const Container& c, uint16_t low);
+    static void toBitmap(Container& c);
+    static void toArrayIfSparse(Container& c);
+    static void andContainer(Container& c, const Container& other);
+    static void orContainer(Container& c, const Container& other);
+    Container* containers; // sorted by key
+    int container_count;
+    int container_capacity;
+};
+
+// One Task4_Bitmap per distinct key (stage code, round, group, day, ...).
+class Task4_BitmapIndex {
+public:
+    Task4_BitmapIndex();
+    ~Task4_BitmapIndex();
+    void clear();
+    void add(int key, int row);
+    void remove(int key, int row);
+    const Task4_Bitmap* find(int key) const; // nullptr when no row has this key
+    int keyCount() const;
+    int keyAt(int i) const;
+    const Task4_Bitmap* bitmapAt(int i) const;
+
+private:
+    Task4_IntIndex slots; // key -> position in keys/bitmaps
+    int* keys;
+    Task4_Bitmap** bitmaps;
+    int count;
+    int capacity;
+};
+
+// Compound filter for Task4_MatchTable::select; unset fields match every row.
+struct Task4_MatchFilter {
+    std::string stage;     // empty = any
+    std::string status;    // empty = any
+    int round;             // -1 = any
+    int group_id;          // -1 = any
+    std::string date_from; // "YYYY-MM-DD", inclusive, empty = open
+    std::string date_to;   // "YYYY-MM-DD", inclusive, empty = open
+
+    Task4_MatchFilter();
+};
+
+// Raw column arrays for a run of match rows, as stored in a Task4_MatchTable or a
+// snapshot segment. Stage/status codes index into the accompanying name lists.
+struct Task4_ColumnView {
+    int rows;
+    const int32_t* match_ids;
+    const int32_t* group_ids;
+    const int32_t* player1_ids;
+    const int32_t* player2_ids;
+    const int32_t* winner_ids;
+    const uint8_t* rounds;
+    const uint8_t* stage_codes;
+    const uint8_t* status_codes;
+    const uint32_t* scores;
+    const int64_t* scheduled_times;
+    const uint8_t* time_formats; // Task4_MatchTable::TIME_*; nullptr means TIME_SECONDS for every known time
+    const std::string* stage_names;
+    int stage_name_count;
+    const std::string* status_names;
+    int status_name_count;
+};
+
+// Columnar match history: one array per field, so a scan only reads the
+// columns its filter needs. Stage/status are dictionary codes, the score is
+// packed into one word and the scheduled time is stored as epoch seconds (UTC)
+// plus the layout it was written in. Rows whose round, time or score would not
+// come back out as written are refused by append().
+class Task4_MatchTable {
+public:
+    static const uint32_t NO_SCORE = 0xFFFFFFFFu;
+    // scheduled_time layouts
+    static const uint8_t TIME_UNKNOWN = 0; // empty
+    static const uint8_t TIME_DATE = 1;    // "YYYY-MM-DD"
+    static const uint8_t TIME_MINUTES = 2; // "YYYY-MM-DD HH:MM", as Task 1 writes it
+    static const uint8_t TIME_SECONDS = 3; // "YYYY-MM-DD HH:MM:SS"
+
+    Task4_MatchTable();
+    ~Task4_MatchTable();
+    Task4_MatchTable(const Task4_MatchTable&) = delete;
+    Task4_MatchTable& operator=(const Task4_MatchTable&) = delete;
+
+    void clear();
+    void reserve(int rows);
+    // Returns the new row, or -1 when rowProblem() refuses it.
+    int append(int match_id, const std::string& stage, int group_id, int round, int player1_id, int player2_id,
+               const std::string& scheduled_time, const std::string& status, int winner_id, const std::string& score);
+    int size() const;
+    // Bulk append: codes are remapped to this table's dictionaries, columns copied as-is.
+    // Returns the first new row.
+    int appendColumns(const Task4_ColumnView& block);
+    void columnsOf(int first_row, int row_count, Task4_ColumnView& out) const; // Pointers stay valid until the next append
+
+    int matchId(int row) const;
+    int groupId(int row) const;
+    int round(int row) const;
+    int player1Id(int row) const;
+    int player2Id(int row) const;
+    int winnerId(int row) const;
+    const std::string& stageName(int row) const;
+    const std::string& statusName(int row) const;
+    bool isCompleted(int row) const;
+    bool hasScore(int row) const;
+    int score1(int row) const;
+    int score2(int row) const;
+    std::string scoreText(int row) const;    // "X-Y", empty when no score was logged
+    long long scheduledAt(int row) const;    // -1 when the time could not be parsed
+    std::string scheduledDate(int row) const; // "YYYY-MM-DD", empty when unknown
+    std::string scheduledTime(int row) const; // As it was appended, empty when unknown
+    bool getRow(int row, Task4_MatchResult& out) const;
+
+    int findRow(int match_id) const; // Latest row for this match id, -1 when absent
+    // Records a result for an existing row: moves it between status bitmaps and, when the
+    // players changed (a TBD slot filled in), between their posting lists.
+    // False, leaving the row as it was, when the score cannot be stored.
+    bool updateResult(int row, int player1_id, int player2_id, const std::string& status, int winner_id,
+                      const std::string& score);
+
+    // Rows a player took part in, ascending, from the posting list kept by append().
+    int rowsForPlayer(int player_id, const int*& rows) const;
+    int countForPlayer(int player_id) const;
+    int playerCount() const; // Distinct player ids seen so far
+
+    // Day directory, ascending by day; rows without a parseable time are not in any block.
+    int dayBlockCount() const;
+    const Task4_DayBlock& dayBlock(int i) const;
+    int firstDayBlockFrom(long long from_time) const; // First block ending at or after from_time
+    const Task4_Bitmap* rowsOnDay(int day) const;      // nullptr when no match is scheduled that day
+    // Completed matches of one player per day within [from_time, to_time]. out must hold
+    // dayBlockCount() entries; only days the player played are written. Returns the count.
+    int playerRecordByDay(int player_id, long long from_time, long long to_time, Task4_DayRecord* out) const;
+
+    // One sequential pass over the status/winner/player/score columns. out must
+    // hold playerCount() entries; only integer sums are accumulated.
+    void aggregatePlayerTotals(Task4_PlayerTotals* out) const;
+
+    // Rows matching every set field of the filter, by bitmap intersection. Returns the count.
+    int select(const Task4_MatchFilter& filter, Task4_Bitmap& out) const;
+
+    static uint32_t packScore(const std::string& score); // NO_SCORE when it is not "X-Y"
+    static long long parseScheduledTime(const std::string& scheduled_time);
+    static uint8_t timeFormatOf(const std::string& scheduled_time); // By length; TIME_UNKNOWN when empty
+    static std::string formatEpoch(long long epoch_seconds, bool with_time);
+    // Why a row with these fields would not round-trip through the table, nullptr when it would.
+    static const char* rowProblem(int round, const std::string& scheduled_time, const std::string& score);
+
+    // Whole-table exports through a BufferedWriter
+    void writeCSV(BufferedWriter& out) const;       // matches.csv layout
+    void writeJSONLines(BufferedWriter& out) const; // One object per match
+    void writeColumnar(BufferedWriter& out) const;  // Column chunks per row group plus a JSON footer
+
+private:
+    struct PostingList {
+        int player_id;
+        int* rows; // ascending row ids
+        int count;
+        int capacity;
+    };
+    void grow(int min_capacity);
+    int addPosting(int player_id, int row); // Returns the player's posting slot
+    void removePosting(int slot, int row);
+    void indexRow(int row); // Posting lists, bitmaps, day blocks and match_rows for a filled row
+    static int internCode(std::string dict[], int& dict_size, const std::string& name);
+    void addToDayBlock(int row);
+    int findDayBlock(int day) const; // Index of the first block with day >= day
+
+    int32_t* match_ids;
+    int32_t* group_ids;
+    int32_t* player1_ids;
+    int32_t* player2_ids;
+    int32_t* winner_ids;
+    int32_t* player1_slots;   // posting slot of player 1, a dense id for aggregation
+    int32_t* player2_slots;
+    uint8_t* rounds;
+    uint8_t* stage_codes;
+    uint8_t* status_codes;
+    uint32_t* scores;         // score1 << 16 | score2, or NO_SCORE
+    int64_t* scheduled_times; // epoch seconds, -1 when unknown
+    uint8_t* time_formats;    // TIME_* each scheduled time was written in
+    int row_count;
+    int row_capacity;
+
+    std::string stage_dict[TASK4_MAX_CODES];
+    int stage_dict_size;
+    std::string status_dict[TASK4_MAX_CODES];
+    int status_dict_size;
+    int completed_code; // status code of "completed", -1 until seen
+
+    Task4_IntIndex match_rows; // match_id -> row
+
+    Task4_DayBlock* day_blocks; // sorted by day
+    int day_block_count;
+    int day_block_capacity;
+
+    Task4_IntIndex posting_slots; // player_id -> index into postings
+    PostingList* postings;
+    int posting_count;
+    int posting_capacity;
+
+    // Secondary indexes, kept up to date by append()
+    Task4_BitmapIndex stage_index;  // by stage code
+    Task4_BitmapIndex status_index; // by status code
+    Task4_BitmapIndex round_index;
+    Task4_BitmapIndex group_index;
+    Task4_BitmapIndex day_index;    // by days since 1970-01-01, rows with a known date only
+};
+
+// Player ranking kept as an order-statistic treap: every node stores its
+// subtree size, so rank lookups and "ranks a..b" walks cost O(log n + k).
+// Nodes are addressed by slot (the player's index in player_stats) and ordered
+// by win rate, then wins, then average score, all descending; ties go to the
+// lower player id. Rates are compared by cross-multiplying, never as doubles.
+class Task4_Leaderboard {
+public:
+    Task4_Leaderboard();
+    ~Task4_Leaderboard();
+    Task4_Leaderboard(const Task4_Leaderboard&) = delete;
+    Task4_Leaderboard& operator=(const Task4_Leaderboard&) = delete;
+
+    void clear();
+    // Inserts the slot, or moves it to the position matching its new stats.
+    void update(int slot, int player_id, int matches, int wins, long long score_total);
+    void remove(int slot);
+    int size() const;
+    int rankOf(int slot) const; // 1-based, -1 when the slot is not ranked
+    // Slots ranked first_rank..last_rank (1-based, inclusive), best first. Returns the count written.
+    int range(int first_rank, int last_rank, int* slots_out) const;
+
+private:
+    struct Node {
+        int player_id;
+        int matches;
+        int wins;
+        long long score_total;
+        unsigned int priority; // heap order, fixed per slot
+        int left;
+        int right;
+        int size;              // nodes in this subtree
+        bool linked;
+    };
+    void ensureSlot(int slot);
+    bool before(int a, int b) const; // true when slot a ranks above slot b
+    int subtreeSize(int node) const;
+    void pull(int node);
+    void split(int node, int key_slot, int& left_out, int& right_out); // left: ranks above key_slot
+    int merge(int left, int right);
+    int unlink(int node, int slot);
+    int collect(int node, int skip, int first_rank, int last_rank, int* slots_out, int written) const;
+
+    Node* nodes;
+    int capacity;
+    int root; // -1 when empty
+};
+
+// Results between one pair of players, from the lower id's side.
+struct Task4_HeadToHeadRecord {
+    int low_id;
+    int high_id;
+    int matches;   // completed matches with a winner
+    int low_wins;
+    int high_wins;
+    int last_row;  // match table row of their latest meeting
+};
+
+// Sparse head-to-head table: (min id, max id) -> record in an open-addressing
+// hash, plus one list of records per player for rival lookups. Only pairs that
+// have actually met take space.
+class Task4_HeadToHead {
+public:
+    Task4_HeadToHead();
+    ~Task4_HeadToHead();
+    Task4_HeadToHead(const Task4_HeadToHead&) = delete;
+    Task4_HeadToHead& operator=(const Task4_HeadToHead&) = delete;
+
+    void clear();
+    void build(const Task4_MatchTable& table); // One pass over every row
+    void applyRow(const Task4_MatchTable& table, int row, int direction); // direction -1 undoes the row
+    const Task4_HeadToHeadRecord* find(int player_a, int player_b) const; // nullptr when they never met
+    // A player's most frequent opponents, most meetings first (ties: latest meeting first). Returns the count.
+    int topRivals(int player_id, int max_count, const Task4_HeadToHeadRecord** out) const;
+    int pairCount() const;
+
+private:
+    struct RivalList {
+        int* records; // indices into records
+        int count;
+        int capacity;
+    };
+    static uint64_t pairKey(int player_a, int player_b);
+    int findRecord(uint64_t key) const;
+    int recordFor(int player_a, int player_b); // Creates the record when missing
+    void rehash(int new_capacity);
+    void addRival(int player_id, int record);
+
+    uint64_t* keys;
+    int* slots;          // record index per used key
+    unsigned char* used;
+    int table_capacity;  // power of two
+    Task4_HeadToHeadRecord* records;
+    int record_count;
+    int record_capacity;
+    Task4_IntIndex rival_slots; // player_id -> index into rivals
+    RivalList* rivals;
+    int rival_count;
+    int rival_capacity;
+};
+
+// Per-player wins/matches over the last window_days days, one bucket per day
+// reused round-robin. The window ends on the latest day with a result, so an
+// update is O(1) and a read sums window_days buckets.
+class Task4_RollingForm {
+public:
+    Task4_RollingForm(int window_days = 7);
+    ~Task4_RollingForm();
+    Task4_RollingForm(const Task4_RollingForm&) = delete;
+    Task4_RollingForm& operator=(const Task4_RollingForm&) = delete;
+
+    void clear();
+    void apply(int slot, int day, bool is_winner, int direction); // direction -1 undoes a result
+    void summary(int slot, int& matches, int& wins) const;
+    int windowDays() const;
+    int lastDay() const; // Latest day seen, -1 before any result
+    // True once retractions have emptied the latest day: the window has to be
+    // refilled from the match table to end on the newest remaining result.
+    bool needsRebuild() const;
+
+private:
+    struct Bucket {
+        int day;
+        int matches;
+        int wins;
+    };
+    void ensureSlot(int slot);
+    Bucket* buckets; // window_days buckets per slot
+    int slot_capacity;
+    int window_days;
+    int last_day;
+    int last_day_results; // Results on last_day over every slot
+};
+
+enum Task4_ExportFormat { TASK4_EXPORT_CSV, TASK4_EXPORT_JSONL, TASK4_EXPORT_COLUMNAR };
+
+// Player fields stored alongside a season's matches in a snapshot.
+struct Task4_SnapshotPlayer {
+    int player_id;
+    const char* name;
+    const char* rank;
+    const char* contact;
+    const char* registration;
+};
+
+// Binary match archive: a file header followed by one segment per season.
+// Each segment carries its columns, the season's players, the stage/status
+// names and an interned string table, padded to 8 bytes so the columns can be
+// read in place from the mapped file. Seasons are only ever appended; every
+// segment has its own FNV-1a checksum. Multi-byte fields use host byte order.
+// Version 2 adds the time layout column; version 1 archives are still read and
+// appended to in their own layout.
+class Task4_Snapshot {
+public:
+    static const uint32_t VERSION = 2;
+
+    Task4_Snapshot();
+    ~Task4_Snapshot();
+    Task4_Snapshot(const Task4_Snapshot&) = delete;
+    Task4_Snapshot& operator=(const Task4_Snapshot&) = delete;
+
+    // Maps the file (read into memory on Windows) and validates every segment. Prints the reason on failure.
+    // A last season cut short by a crash is not a failure: it is left out and hasTornTail() is set.
+    bool open(const std::string& path);
+    void close();
+    bool hasTornTail() const;
+    // Closes the file and cuts a torn last season off it so the next season follows the valid ones.
+    bool dropTornTail(const std::string& path);
+    int seasonCount() const;
+    int seasonId(int season) const;
+    int seasonRows(int season) const;
+    int seasonPlayerCount(int season) const;
+    // Views into the mapped file; valid until close(). names must hold TASK4_MAX_CODES * 2 strings.
+    void seasonColumns(int season, Task4_ColumnView& out, std::string* names) const;
+    Task4_SnapshotPlayer seasonPlayer(int season, int index) const;
+
+    // Writes one segment at the end of the file, creating the file header when needed.
+    static bool appendSeason(const std::string& path, int season_id, const Task4_ColumnView& matches,
+                             const Task4_PlayerStats* players, int player_count);
+
+private:
+    struct Segment {
+        uint32_t season_id;
+        uint32_t rows;
+        uint32_t players;
+        uint32_t string_bytes;
+        uint16_t stage_count;
+        uint16_t status_count;
+        const unsigned char* payload;
+    };
+    const unsigned char* data;
+    size_t data_size;
+    uint32_t version; // Of the open file
+    bool mapped;      // data came from mmap rather than owned_buffer
+    uint64_t* owned_buffer;
+    Segment* segments;
+    int segment_count;
+    size_t valid_size; // Bytes up to the end of the last valid segment
 };
 
 class Task4_GameResultManager {
@@ -357,28 +1618,69 @@ public:
     void displayRecentMatches(int count = 5);
     void displayPlayerStats(int player_id);
     void displayAllPlayerStats();
+    void displayLeaderboard(int first_rank, int last_rank); // e.g. (1, 10) for the top 10
+    int playerRank(int player_id) const; // 1-based leaderboard position, -1 when unknown
+    void displayHeadToHead(int player_a, int player_b);
+    void displayTopRivals(int player_id, int count = 5);
+    bool exportHeadToHeadMatrix(int top_n, const std::string& filename); // Top N leaderboard seeds, CSV
+    void displayPlayerForm(int player_id);        // Rolling window (last 7 days) with a per-day breakdown
+    void displayWinRateByDay(int player_id);      // One line per tournament day the player played
+    // Appends the rows not yet archived as the next season of the binary archive.
+    bool saveSeasonSnapshot(const std::string& path);
+    bool loadSnapshot(const std::string& path); // Replaces resident data with every archived season
+    bool exportMatches(const std::string& filename, Task4_ExportFormat format);
+    bool exportPlayerStats(const std::string& filename, Task4_ExportFormat format); // CSV or JSON Lines
     void queryMatchesByPlayer(int player_id);
     void queryMatchesByStage(const std::string& stage);
+    int queryMatches(const Task4_MatchFilter& filter, Task4_Bitmap& rows) const; // Returns the match count
+    void displayFilteredMatches(const Task4_MatchFilter& filter);
     void runProgram(); // Main operational loop for Task 4
+    void ensureDataLoaded(); // Reads the CSVs on first use; runProgram and the service mode share it
+    const Task4_PlayerStats* getPlayerStats(int player_id) const; // nullptr when unknown
+
+    // Applies one finished match to the resident data: O(1) stats, stack and index updates.
+    void recordMatchResult(const Task4_MatchResult& result);
+    static void onMatchCompleted(const Match* match, void* context); // MatchCompletedCallback for Tournament
 
 private:
     // Helper methods
     std::string extractDateFromScheduledTime(const std::string& scheduled_time);
     void splitCSVLine(const std::string& line, std::string tokens[], int max_tokens);
     int findPlayerIndex(int player_id); // Finds index in player_stats array
-    double parseScore(const std::string& score_str); // Parses score like "X-Y", returns X
-    void updatePlayerStats(int player_id, bool is_winner, double score);
+    void updatePlayerStats(int player_id, bool is_winner, int score, int direction = 1); // direction -1 undoes a result
+    void applyRowToStats(int row, int direction);
+    void applyRowToForm(int row, int direction);
+    void rebuildRollingForm();
+    void refillRecentMatches(); // Newest TASK4_MAX_CAPACITY rows of match_table onto recent_matches
+    void refreshRank(int index); // Re-inserts player_stats[index] into the leaderboard
+    void rebuildPlayerStats(); // Re-aggregates every player's stats from match_table
     void displayMenu_Task4(); // Displays Task 4 specific menu
+    void printMatchRows(const Task4_Bitmap& rows); // Shared table layout for stage/filter queries
 
     Task4_PlayerStats* player_stats; // Dynamically allocated array of player statistics
+    Task4_IntIndex player_index;     // player_id -> index in player_stats
+    Task4_Leaderboard leaderboard;   // player_stats indices in rank order, updated with the stats
+    Task4_HeadToHead head_to_head;   // Pair records over match_table, updated with the stats
+    Task4_RollingForm rolling_form;  // Last-7-days form per player_stats index
     int task4_max_players;
     int current_player_count;
 
-    Task4_Stack recent_matches; // Stores recent matches (e.g., last N matches)
-    Task4_Queue match_history;  // Stores all matches loaded or processed
+    Task4_Stack recent_matches;   // Last TASK4_MAX_CAPACITY matches, most recent on top
+    Task4_MatchTable match_table; // Every match loaded, stored column by column
 
     int next_match_id; // Potentially used if new matches were to be logged by this system
+    bool data_loaded;  // CSVs are read once; later results arrive through recordMatchResult
 };
 
+// Service mode (EsportsChampionship --serve): a local HTTP/JSON API over the same Task 1
+// tournament, Task 2 registry and Task 4 history, for several check-in desks at once.
+// Linux only (epoll); returns the process exit code.
+struct ServiceOptions {
+    int port;
+    const char* bind_address; // IPv4
+    int max_connections;
+    ServiceOptions(); // 8080 on 127.0.0.1, 1024 connections
+};
+int runServiceMode(const ServiceOptions& options);
 
 #endif // APUEC_SYSTEM_H
\ No newline at end of file
@@ -13,13 +13,14 @@ public:
     bool wantsLiveStream;
     int paymentAmount;
     bool active; // active in tournament or left
+    int listIndex; // position in the SpectatorList, used as the watch history row
     Spectator* next;
 
     Spectator(string _id, string _name, bool _wantsLiveStream, string _supportedPlayer,
               string _category, string _day)
         : id(_id), name(_name), wantsLiveStream(_wantsLiveStream),
           supportedPlayer(_supportedPlayer), category(_category), day(_day),
-          next(nullptr), active(true) {
+          next(nullptr), active(true), listIndex(-1) {
         assignPaymentAmount();
     }
 
@@ -34,14 +35,32 @@ public:
 class SpectatorList {
     Spectator* head;
     int nextId;  // auto-increment ID counter
+    int count;   // number of spectators in the list
+
+    void append(Spectator* newNode) {
+        newNode->listIndex = count++;
+        if (!head) head = newNode;
+        else {
+            Spectator* temp = head;
+            while (temp->next) temp = temp->next;
+            temp->next = newNode;
+        }
+    }
 public:
-    SpectatorList() : head(nullptr), nextId(1) {}
+    SpectatorList() : head(nullptr), nextId(1), count(0) {}
 
     ~SpectatorList() {
         clear();
     }
 
     Spectator* getHead() const { return head; }
+    int size() const { return count; }
+
+    Spectator* findById(const string& id) const {
+        Spectator* cur = head;
+        while (cur && cur->id != id) cur = cur->next;
+        return cur;
+    }
 
     void clear() {
         Spectator* current = head;
@@ -52,6 +71,7 @@ public:
         }
         head = nullptr;
         nextId = 1;
+        count = 0;
     }
 
     // Auto-generate ID and return it
@@ -61,13 +81,7 @@ public:
         ss << "S" << setfill('0') << setw(3) << nextId++;
         string id = ss.str();
 
-        Spectator* newNode = new Spectator(id, name, wantsLiveStream, supportedPlayer, category, day);
-        if (!head) head = newNode;
-        else {
-            Spectator* temp = head;
-            while (temp->next) temp = temp->next;
-            temp->next = newNode;
-        }
+        append(new Spectator(id, name, wantsLiveStream, supportedPlayer, category, day));
         return id; // return generated ID
     }
 
@@ -96,14 +110,7 @@ public:
             getline(ss, paymentStr, ',');
 
             bool wantsLiveStream = (wantsLiveStreamStr == "Yes" || wantsLiveStreamStr == "yes");
-            Spectator* newNode = new Spectator(id, name, wantsLiveStream, supportedPlayer, category, day);
-
-            if (!head) head = newNode;
-            else {
-                Spectator* temp = head;
-                while (temp->next) temp = temp->next;
-                temp->next = newNode;
-            }
+            append(new Spectator(id, name, wantsLiveStream, supportedPlayer, category, day));
 
             // Robust parsing of numeric part of ID
             if (!id.empty() && id[0] == 'S') {
@@ -316,70 +323,128 @@ public:
 };
 
 // -------- MultiLevelLiveStreamQueue (linked list) --------
+// Three FIFO tiers (Influencer, VIP, General). Each tier keeps its own head/tail
+// pointer and counter so enqueue, dequeue and the capacity check are all O(1).
+// dequeue() admits viewers using smooth weighted round-robin across the tiers,
+// so a busy General tier still gets a share of the slots instead of starving.
 class MultiLevelLiveStreamQueue {
     struct Node {
         Spectator* data;
         Node* next;
         Node(Spectator* sp) : data(sp), next(nullptr) {}
     };
-    Node* influencerHead;
-    Node* vipHead;
-    Node* generalHead;
+    struct Tier {
+        Node* head;
+        Node* tail;
+        int count;
+        int weight;        // share of admissions relative to the other tiers
+        int currentWeight; // running credit used by the weighted round-robin
+        Tier() : head(nullptr), tail(nullptr), count(0), weight(1), currentWeight(0) {}
+    };
+    enum { INFLUENCER = 0, VIP = 1, GENERAL = 2, TIER_COUNT = 3 };
+
+    Tier tiers[TIER_COUNT];
+    int totalCount;
     int capacity;
 
-    int countList(Node* head) const {
-        int cnt = 0;
-        while (head) {
-            cnt++;
-            head = head->next;
-        }
-        return cnt;
+    static int tierFor(const string& category) {
+        if (category == "Influencer") return INFLUENCER;
+        if (category == "VIP") return VIP;
+        return GENERAL;
     }
 
 public:
-    MultiLevelLiveStreamQueue(int cap)
-        : influencerHead(nullptr), vipHead(nullptr), generalHead(nullptr), capacity(cap) {}
+    MultiLevelLiveStreamQueue(int cap, int influencerWeight = 3, int vipWeight = 2, int generalWeight = 1)
+        : totalCount(0), capacity(cap) {
+        setWeights(influencerWeight, vipWeight, generalWeight);
+    }
 
-    void enqueue(Spectator* sp) {
-        if (getTotalCount() >= capacity) {
-            cout << "Live stream full, " << sp->name << " cannot join.\n";
-            return;
+    ~MultiLevelLiveStreamQueue() {
+        for (int t = 0; t < TIER_COUNT; t++) {
+            Node* cur = tiers[t].head;
+            while (cur) {
+                Node* tmp = cur;
+                cur = cur->next;
+                delete tmp;
+            }
         }
-        Node** target;
-        if (sp->category == "Influencer") target = &influencerHead;
-        else if (sp->category == "VIP") target = &vipHead;
-        else target = &generalHead;
+    }
+
+    // Weights below 1 are clamped to 1 so every tier is eventually served.
+    void setWeights(int influencerWeight, int vipWeight, int generalWeight) {
+        tiers[INFLUENCER].weight = influencerWeight > 0 ? influencerWeight : 1;
+        tiers[VIP].weight = vipWeight > 0 ? vipWeight : 1;
+        tiers[GENERAL].weight = generalWeight > 0 ? generalWeight : 1;
+        for (int t = 0; t < TIER_COUNT; t++) tiers[t].currentWeight = 0;
+    }
 
+    bool isFull() const { return totalCount >= capacity; }
+    bool isEmpty() const { return totalCount == 0; }
+    int getTotalCount() const { return totalCount; }
+
+    bool enqueue(Spectator* sp) {
+        if (isFull()) {
+            cout << "Live stream full, " << sp->name << " cannot join.\n";
+            return false;
+        }
+        Tier& tier = tiers[tierFor(sp->category)];
         Node* newNode = new Node(sp);
-        if (!*target) *target = newNode;
+        if (!tier.tail) tier.head = tier.tail = newNode;
         else {
-            Node* temp = *target;
-            while (temp->next) temp = temp->next;
-            temp->next = newNode;
+            tier.tail->next = newNode;
+            tier.tail = newNode;
+        }
+        tier.count++;
+        totalCount++;
+        return true;
+    }
+
+    // Admits the next viewer. Every non-empty tier earns its weight in credit,
+    // the richest tier is served and pays back the total weight in play.
+    Spectator* dequeue() {
+        if (isEmpty()) return nullptr;
+        int best = -1;
+        int activeWeight = 0;
+        for (int t = 0; t < TIER_COUNT; t++) {
+            if (!tiers[t].head) continue;
+            tiers[t].currentWeight += tiers[t].weight;
+            activeWeight += tiers[t].weight;
+            if (best == -1 || tiers[t].currentWeight > tiers[best].currentWeight) best = t;
+        }
+        Tier& tier = tiers[best];
+        tier.currentWeight -= activeWeight;
+
+        Node* node = tier.head;
+        Spectator* sp = node->data;
+        tier.head = node->next;
+        if (!tier.head) {
+            tier.tail = nullptr;
+            tier.currentWeight = 0; // an emptied tier does not bank credit
         }
+        delete node;
+        tier.count--;
+        totalCount--;
+        return sp;
     }
 
     void displayQueue() const {
-        cout << "\n[Live Stream Queue - Priority Groups]:\n";
+        cout << "\n[Live Stream Queue - Priority Groups] (" << totalCount << "/" << capacity << "):\n";
         int count = 1;
-        count = displayGroup("Influencers", influencerHead, count);
-        count = displayGroup("VIPs", vipHead, count);
-        displayGroup("Generals", generalHead, count);
+        count = displayGroup("Influencers", tiers[INFLUENCER], count);
+        count = displayGroup("VIPs", tiers[VIP], count);
+        displayGroup("Generals", tiers[GENERAL], count);
     }
 
 private:
-    int displayGroup(const string& label, Node* head, int count) const {
-        cout << "-- " << label << " --\n";
+    int displayGroup(const string& label, const Tier& tier, int count) const {
+        cout << "-- " << label << " (" << tier.count << ", weight " << tier.weight << ") --\n";
+        Node* head = tier.head;
         while (head) {
             cout << count++ << ". " << head->data->name << "\n";
             head = head->next;
         }
         return count;
     }
-
-    int getTotalCount() const {
-        return countList(influencerHead) + countList(vipHead) + countList(generalHead);
-    }
 };
 
 // -------- CircularStreamRotation (linked list) --------
@@ -457,32 +522,100 @@ public:
     }
 };
 
-// -------- WatchHistoryStack (linked list stack) --------
+// -------- WatchHistoryStack (per-spectator ring buffers) --------
+// Keeps the last K watch events of every spectator. All rings live in one
+// arena allocated up front (spectators x K), so pushing is O(1), never
+// allocates, and memory stays flat however long the championship runs; once a
+// ring is full the oldest event is overwritten. Rows are addressed by
+// Spectator::listIndex.
+struct WatchEvent {
+    int matchId;          // match on stream, 0 when not tied to a match
+    long long startedAt;  // simulated seconds since the stream started
+    int seconds;          // how long the spectator watched
+};
+
 class WatchHistoryStack {
-    struct Node {
-        Spectator* data;
-        Node* next;
-        Node(Spectator* sp) : data(sp), next(nullptr) {}
-    };
-    Node* top;
+    WatchEvent* arena;  // rowCount * perSpectator events
+    int* writePos;      // next slot to write in each ring
+    int* used;          // events stored in each ring (<= perSpectator)
+    Spectator** owners; // spectator owning each row, for display
+    int rowCount;
+    int perSpectator;
+    long long totalPushed;
+
+    bool validRow(const Spectator* sp) const {
+        return sp && sp->listIndex >= 0 && sp->listIndex < rowCount;
+    }
 
 public:
-    WatchHistoryStack() : top(nullptr) {}
+    WatchHistoryStack(int spectatorCount, int eventsPerSpectator = 8)
+        : rowCount(spectatorCount > 0 ? spectatorCount : 1),
+          perSpectator(eventsPerSpectator > 0 ? eventsPerSpectator : 1), totalPushed(0) {
+        arena = new WatchEvent[(size_t)rowCount * perSpectator];
+        writePos = new int[rowCount];
+        used = new int[rowCount];
+        owners = new Spectator*[rowCount];
+        for (int i = 0; i < rowCount; i++) {
+            writePos[i] = used[i] = 0;
+            owners[i] = nullptr;
+        }
+    }
 
-    void push(Spectator* sp) {
-        Node* newNode = new Node(sp);
-        newNode->next = top;
-        top = newNode;
+    ~WatchHistoryStack() {
+        delete[] arena;
+        delete[] writePos;
+        delete[] used;
+        delete[] owners;
+    }
+
+    bool push(Spectator* sp, int matchId, long long startedAt, int seconds) {
+        if (!validRow(sp)) return false;
+        int row = sp->listIndex;
+        WatchEvent& ev = arena[(size_t)row * perSpectator + writePos[row]];
+        ev.matchId = matchId;
+        ev.startedAt = startedAt;
+        ev.seconds = seconds;
+        writePos[row] = (writePos[row] + 1) % perSpectator;
+        if (used[row] < perSpectator) used[row]++;
+        owners[row] = sp;
+        totalPushed++;
+        return true;
+    }
+
+    int countFor(const Spectator* sp) const { return validRow(sp) ? used[sp->listIndex] : 0; }
+
+    // Event i of the spectator's history, 0 being the most recent.
+    bool getFromTop(const Spectator* sp, int i, WatchEvent& out) const {
+        if (!validRow(sp) || i < 0 || i >= used[sp->listIndex]) return false;
+        int row = sp->listIndex;
+        int slot = (writePos[row] - 1 - i + perSpectator) % perSpectator;
+        out = arena[(size_t)row * perSpectator + slot];
+        return true;
+    }
+
+    void displayFor(const Spectator* sp) const {
+        if (!sp) return;
+        cout << sp->id << " " << sp->name << " watched (latest first):\n";
+        WatchEvent ev;
+        int n = countFor(sp);
+        if (n == 0) cout << "  (nothing yet)\n";
+        for (int i = 0; i < n && getFromTop(sp, i, ev); i++) {
+            cout << "  " << (i + 1) << ". t=" << ev.startedAt << "s for " << ev.seconds << "s";
+            if (ev.matchId) cout << " (match " << ev.matchId << ")";
+            cout << "\n";
+        }
     }
 
     void display() const {
-        cout << "\n[Watch History - Stack]:\n";
-        Node* current = top;
-        int count = 1;
-        while (current) {
-            cout << count++ << ". " << current->data->name << "\n";
-            current = current->next;
+        cout << "\n[Watch History - last " << perSpectator << " per spectator, "
+             << totalPushed << " events logged]:\n";
+        bool any = false;
+        for (int row = 0; row < rowCount; row++) {
+            if (!owners[row]) continue;
+            displayFor(owners[row]);
+            any = true;
         }
+        if (!any) cout << "(empty)\n";
     }
 };
 
@@ -495,10 +628,20 @@ class WaitingQueue {
     };
     Node* front;
     Node* rear;
+    int count;
 public:
-    WaitingQueue() : front(nullptr), rear(nullptr) {}
+    WaitingQueue() : front(nullptr), rear(nullptr), count(0) {}
+
+    ~WaitingQueue() {
+        while (front) {
+            Node* tmp = front;
+            front = front->next;
+            delete tmp;
+        }
+    }
 
     bool isEmpty() const { return front == nullptr; }
+    int size() const { return count; }
 
     void enqueue(Spectator* sp) {
         Node* newNode = new Node(sp);
@@ -508,6 +651,7 @@ public:
             rear->next = newNode;
             rear = newNode;
         }
+        count++;
     }
 
     Spectator* dequeue() {
@@ -517,10 +661,168 @@ public:
         front = front->next;
         if (!front) rear = nullptr;
         delete tmp;
+        count--;
         return sp;
     }
 };
 
+// -------- SimulatedClock --------
+// Seconds since the start of the stream. Nothing reads the wall clock, so the
+// rotation can be replayed deterministically offline.
+class SimulatedClock {
+    long long nowSeconds;
+public:
+    SimulatedClock(long long start = 0) : nowSeconds(start) {}
+    long long now() const { return nowSeconds; }
+    void advance(long long seconds) { if (seconds > 0) nowSeconds += seconds; }
+};
+
+// -------- StreamRotationScheduler (timer wheel) --------
+// Time-sliced live stream rotation. Each viewer on stream holds a slot for
+// slotSeconds; slots sit in a hashed timer wheel with one bucket per second.
+// Because every slot has the same length, a wheel of slotSeconds + 1 buckets
+// never holds two laps at once, so a tick only touches the bucket that is due:
+// O(1) per tick plus O(1) per slot that expires on it. Expired viewers go to
+// the back of the waiting queue and the front of the queue is promoted into
+// the freed slot. Slots come from a pool sized to the rotation capacity, so the
+// steady state does not allocate on stream.
+class StreamRotationScheduler {
+    struct Slot {
+        Spectator* viewer;
+        long long expiresAt;
+        int prev, next; // links inside a wheel bucket (slot indexes, -1 = none)
+    };
+    Slot* slots;
+    int* freeSlots;   // stack of unused slot indexes
+    int freeCount;
+    int capacity;
+    int* wheel;       // head slot index per bucket, -1 when empty
+    int* wheelTail;   // tail slot index per bucket, keeps expiry order FIFO
+    int wheelSize;
+    int slotSeconds;
+    long long currentTick;
+    long long expiredTotal;
+    long long promotedTotal;
+    bool verbose;
+    int streamMatchId;          // match currently on stream, logged with each slot
+    WatchHistoryStack* history; // optional, receives every finished slot
+    SimulatedClock& clock;
+    WaitingQueue waiting;
+
+    void linkIntoBucket(int idx) {
+        int bucket = (int)(slots[idx].expiresAt % wheelSize);
+        slots[idx].prev = wheelTail[bucket];
+        slots[idx].next = -1;
+        if (wheelTail[bucket] != -1) slots[wheelTail[bucket]].next = idx;
+        else wheel[bucket] = idx;
+        wheelTail[bucket] = idx;
+    }
+
+    void startSlot(Spectator* sp) {
+        int idx = freeSlots[--freeCount];
+        slots[idx].viewer = sp;
+        slots[idx].expiresAt = currentTick + slotSeconds;
+        linkIntoBucket(idx);
+    }
+
+    // Fill free slots from the waiting queue, skipping viewers who have left.
+    void promoteWaiting() {
+        while (freeCount > 0 && !waiting.isEmpty()) {
+            Spectator* next = waiting.dequeue();
+            if (!next->active) continue;
+            startSlot(next);
+            promotedTotal++;
+            if (verbose) cout << "  [t=" << currentTick << "s] " << next->name << " promoted to live stream\n";
+        }
+    }
+
+    void processTick() {
+        int bucket = (int)(currentTick % wheelSize);
+        int idx = wheel[bucket];
+        wheel[bucket] = wheelTail[bucket] = -1;
+        while (idx != -1) {
+            int nextIdx = slots[idx].next;
+            Spectator* sp = slots[idx].viewer;
+            slots[idx].viewer = nullptr;
+            freeSlots[freeCount++] = idx;
+            expiredTotal++;
+            if (verbose) cout << "  [t=" << currentTick << "s] " << sp->name << "'s slot expired\n";
+            if (history) history->push(sp, streamMatchId, currentTick - slotSeconds, slotSeconds);
+            if (sp->active) waiting.enqueue(sp); // rejoin the back of the line
+            idx = nextIdx;
+        }
+        promoteWaiting();
+    }
+
+public:
+    StreamRotationScheduler(int cap, int slotLengthSeconds, SimulatedClock& clk)
+        : freeCount(0), capacity(cap > 0 ? cap : 1),
+          slotSeconds(slotLengthSeconds > 0 ? slotLengthSeconds : 1),
+          currentTick(clk.now()), expiredTotal(0), promotedTotal(0), verbose(false),
+          streamMatchId(0), history(nullptr), clock(clk) {
+        slots = new Slot[capacity];
+        freeSlots = new int[capacity];
+        for (int i = capacity - 1; i >= 0; i--) {
+            slots[i].viewer = nullptr;
+            slots[i].expiresAt = 0;
+            slots[i].prev = slots[i].next = -1;
+            freeSlots[freeCount++] = i;
+        }
+        wheelSize = slotSeconds + 1;
+        wheel = new int[wheelSize];
+        wheelTail = new int[wheelSize];
+        for (int i = 0; i < wheelSize; i++) wheel[i] = wheelTail[i] = -1;
+    }
+
+    ~StreamRotationScheduler() {
+        delete[] slots;
+        delete[] freeSlots;
+        delete[] wheel;
+        delete[] wheelTail;
+    }
+
+    void setVerbose(bool on) { verbose = on; }
+    void setHistory(WatchHistoryStack* h) { history = h; }
+    void setStreamMatch(int matchId) { streamMatchId = matchId; }
+    int onStreamCount() const { return capacity - freeCount; }
+    int waitingCount() const { return waiting.size(); }
+    long long expiredCount() const { return expiredTotal; }
+    long long promotedCount() const { return promotedTotal; }
+    long long now() const { return currentTick; }
+
+    // Puts the viewer on stream immediately if a slot is free, otherwise in line.
+    void addViewer(Spectator* sp) {
+        if (!sp || !sp->active) return;
+        if (freeCount > 0 && waiting.isEmpty()) startSlot(sp);
+        else waiting.enqueue(sp);
+    }
+
+    // Catch up with the simulated clock, one wheel tick per elapsed second.
+    void advanceTo(long long targetSeconds) {
+        while (currentTick < targetSeconds) {
+            currentTick++;
+            processTick();
+        }
+    }
+
+    void run(long long seconds) {
+        clock.advance(seconds);
+        advanceTo(clock.now());
+    }
+
+    void displayQueue() const {
+        cout << "\n[Timed Live Stream Rotation] t=" << currentTick << "s, slot " << slotSeconds << "s, "
+             << onStreamCount() << "/" << capacity << " on stream, " << waiting.size() << " waiting\n";
+        int count = 1;
+        for (int i = 0; i < capacity; i++) {
+            if (!slots[i].viewer) continue;
+            cout << count++ << ". " << slots[i].viewer->name << " (slot ends t="
+                 << slots[i].expiresAt << "s)\n";
+        }
+        if (count == 1) cout << "(empty)\n";
+    }
+};
+
 // -------- Update spectators based on match results --------
 void updateSpectatorsByMatchResults(SpectatorList& spectators, MatchList& matches,
                                     const string& stage, int round) {
@@ -548,7 +850,7 @@ void simulateQueueManagement(SpectatorList& regList) {
     PrioritySeatingQueue seatQueue;
     MultiLevelLiveStreamQueue streamQueue(10);
     CircularStreamRotation rotation(5);
-    WatchHistoryStack history;
+    WatchHistoryStack history(regList.size(), 4);
     WaitingQueue waitingQueue;
 
     Spectator* ptr = regList.getHead();
@@ -566,7 +868,6 @@ void simulateQueueManagement(SpectatorList& regList) {
                 cout << ptr->name << " added to waiting queue for rotation\n";
                 waitingQueue.enqueue(ptr);
             }
-            history.push(ptr);
         }
         ptr = ptr->next;
     }
@@ -574,22 +875,40 @@ void simulateQueueManagement(SpectatorList& regList) {
     seatQueue.displayQueue();
     streamQueue.displayQueue();
     rotation.displayQueue();
-    history.display();
 
-    cout << "\nRotating live stream...\n";
-    Spectator* removed = rotation.dequeue();
-    if (removed) {
-        cout << "Removed from rotation: " << removed->name << "\n";
+    cout << "\nAdmitting live stream viewers (weighted Influencer/VIP/General)...\n";
+    int admitted = 0;
+    Spectator* viewer = streamQueue.dequeue();
+    while (viewer) {
+        cout << ++admitted << ". Admitted: " << viewer->name << " (" << viewer->category << ")\n";
+        viewer = streamQueue.dequeue();
     }
-    if (!waitingQueue.isEmpty()) {
-        Spectator* nextInLine = waitingQueue.dequeue();
-        rotation.enqueue(nextInLine);
-        cout << "Moved from waiting queue to rotation: " << nextInLine->name << "\n";
-    } else {
-        cout << "Moved from waiting queue to rotation: (none, waiting queue empty)\n";
+    if (admitted == 0) cout << "(no viewers waiting for the live stream)\n";
+
+    // Hand the rotation and its waiting line over to the timed scheduler and
+    // play a few slots on the simulated clock.
+    const int slotSeconds = 30;
+    SimulatedClock streamClock;
+    StreamRotationScheduler scheduler(5, slotSeconds, streamClock);
+    Spectator* onStream = rotation.dequeue();
+    while (onStream) {
+        scheduler.addViewer(onStream);
+        onStream = rotation.dequeue();
+    }
+    Spectator* queued = waitingQueue.dequeue();
+    while (queued) {
+        scheduler.addViewer(queued);
+        queued = waitingQueue.dequeue();
     }
 
-    rotation.displayQueue();
+    cout << "\nRunning timed live stream rotation (" << slotSeconds << "s slots, 3 rounds)...\n";
+    scheduler.setVerbose(true);
+    scheduler.setHistory(&history);
+    scheduler.run(3 * slotSeconds);
+    cout << "Slots expired: " << scheduler.expiredCount()
+         << ", promotions from waiting queue: " << scheduler.promotedCount() << "\n";
+    scheduler.displayQueue();
+    history.display();
 }
 
 // -------- Menu and helper functions --------
@@ -11,6 +11,7 @@ public:
     bool wantsLiveStream;
     int paymentAmount;
     bool active;
+    int listIndex; // position in SpectatorList, row in WatchHistoryStack
     Spectator* next;
 
     Spectator(string _id, string _name, bool _wantsLiveStream, string _supportedPlayer,
@@ -23,11 +24,16 @@ public:
 class SpectatorList {
     Spectator* head;
     int nextId;  // auto-increment ID counter
+    int count;   // number of spectators in the list
+
+    void append(Spectator* newNode); // Assigns listIndex and links at the tail
 public:
     SpectatorList();
     ~SpectatorList(); // Destructor to clean up linked list
 
     Spectator* getHead() const;
+    int size() const;
+    Spectator* findById(const string& id) const;
 
     // Register spectator with auto-generated ID, returns generated ID
     string registerSpectator(const string& name, bool wantsLiveStream,
@@ -95,18 +101,33 @@ public:
 };
 
 // -------- MultiLevelLiveStreamQueue --------
+// Per-tier head/tail/count, O(1) enqueue/dequeue, weighted admission across tiers.
 class MultiLevelLiveStreamQueue {
     struct Node;
-    Node* influencerHead;
-    Node* vipHead;
-    Node* generalHead;
+    struct Tier {
+        Node* head;
+        Node* tail;
+        int count;
+        int weight;
+        int currentWeight;
+        Tier();
+    };
+    enum { INFLUENCER = 0, VIP = 1, GENERAL = 2, TIER_COUNT = 3 };
+    Tier tiers[TIER_COUNT];
+    int totalCount;
     int capacity;
 
-    int countList(Node* head) const;
+    static int tierFor(const string& category);
+    int displayGroup(const string& label, const Tier& tier, int count) const;
 public:
-    MultiLevelLiveStreamQueue(int cap);
+    MultiLevelLiveStreamQueue(int cap, int influencerWeight = 3, int vipWeight = 2, int generalWeight = 1);
     ~MultiLevelLiveStreamQueue();
-    void enqueue(Spectator* sp);
+    void setWeights(int influencerWeight, int vipWeight, int generalWeight);
+    bool isFull() const;
+    bool isEmpty() const;
+    int getTotalCount() const;
+    bool enqueue(Spectator* sp);
+    Spectator* dequeue(); // Admits next viewer by weighted round-robin
     void displayQueue() const;
 };
 
@@ -127,13 +148,30 @@ public:
 };
 
 // -------- WatchHistoryStack --------
+// Last K watch events per spectator, in one arena of spectatorCount * K events.
+struct WatchEvent {
+    int matchId;
+    long long startedAt;
+    int seconds;
+};
+
 class WatchHistoryStack {
-    struct Node;
-    Node* top;
+    WatchEvent* arena;
+    int* writePos;
+    int* used;
+    Spectator** owners;
+    int rowCount;
+    int perSpectator;
+    long long totalPushed;
+
+    bool validRow(const Spectator* sp) const;
 public:
-    WatchHistoryStack();
+    WatchHistoryStack(int spectatorCount, int eventsPerSpectator = 8);
     ~WatchHistoryStack();
-    void push(Spectator* sp);
+    bool push(Spectator* sp, int matchId, long long startedAt, int seconds); // O(1), overwrites oldest
+    int countFor(const Spectator* sp) const;
+    bool getFromTop(const Spectator* sp, int i, WatchEvent& out) const; // 0 = most recent
+    void displayFor(const Spectator* sp) const;
     void display() const;
 };
 
@@ -142,14 +180,67 @@ class WaitingQueue {
     struct Node;
     Node* front;
     Node* rear;
+    int count;
 public:
     WaitingQueue();
     ~WaitingQueue();
     bool isEmpty() const;
+    int size() const;
     void enqueue(Spectator* sp);
     Spectator* dequeue();
 };
 
+// -------- SimulatedClock --------
+class SimulatedClock {
+    long long nowSeconds;
+public:
+    SimulatedClock(long long start = 0);
+    long long now() const;
+    void advance(long long seconds);
+};
+
+// -------- StreamRotationScheduler --------
+// Timer-wheel rotation: fixed-length slots, auto-promotion from the waiting queue.
+class StreamRotationScheduler {
+    struct Slot;
+    Slot* slots;
+    int* freeSlots;
+    int freeCount;
+    int capacity;
+    int* wheel;
+    int* wheelTail;
+    int wheelSize;
+    int slotSeconds;
+    long long currentTick;
+    long long expiredTotal;
+    long long promotedTotal;
+    bool verbose;
+    int streamMatchId;
+    WatchHistoryStack* history;
+    SimulatedClock& clock;
+    WaitingQueue waiting;
+
+    void linkIntoBucket(int idx);
+    void startSlot(Spectator* sp);
+    void promoteWaiting();
+    void processTick();
+public:
+    StreamRotationScheduler(int cap, int slotLengthSeconds, SimulatedClock& clk);
+    ~StreamRotationScheduler();
+    void setVerbose(bool on);
+    void setHistory(WatchHistoryStack* h); // Log every finished slot
+    void setStreamMatch(int matchId);
+    int onStreamCount() const;
+    int waitingCount() const;
+    long long expiredCount() const;
+    long long promotedCount() const;
+    long long now() const;
+    void addViewer(Spectator* sp);
+    void advanceTo(long long targetSeconds);
+    void run(long long seconds); // Advances the clock and processes due ticks
+    void displayQueue() const;
+};
+
 // -------- Utility functions --------
 void updateSpectatorsByMatchResults(SpectatorList& spectators, MatchList& matches,
                                     const string& stage, int round);
@@ -0,0 +1,238 @@
+// Minimal micro-benchmark harness modelled on Google Benchmark, so the suite
+// builds with nothing but the standard library.
+//
+// A benchmark is a function taking a State, registered with APUEC_BENCHMARK and
+// given a size range (powers of ten). The harness repeats each size with more
+// iterations until a run lasts at least min_time, prints one table row per size,
+// and writes every result to a JSON file in Google Benchmark's layout so runs
+// can be compared with its tools or any JSON diff.
+//
+// Flags: --benchmark_filter=<substring>  --benchmark_min_time=<seconds>
+//        --benchmark_out=<file.json>      (default <program>.json)
+//
+// The modules print progress on stdout; it is discarded while a benchmark runs.
+
+#ifndef APUEC_BENCH_HARNESS_HPP
+#define APUEC_BENCH_HARNESS_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <thread>
+#include <fcntl.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace apuec_bench {
+
+class State {
+public:
+    State(long long size, long long max_iterations)
+        : size_(size), max_iterations_(max_iterations), iterations_(0), items_(0), bytes_(0),
+          paused_(true), real_ns_(0), cpu_ns_(0) {}
+
+    // for (...; state.keepRunning(); ) { timed body }
+    bool keepRunning() {
+        if (iterations_ == 0) resumeTiming();
+        if (iterations_ < max_iterations_) { iterations_++; return true; }
+        pauseTiming();
+        return false;
+    }
+    // Excludes setup or teardown inside the loop from the measurement.
+    void pauseTiming() {
+        if (paused_) return;
+        real_ns_ += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - real_start_).count();
+        cpu_ns_ += (double)(std::clock() - cpu_start_) * 1e9 / CLOCKS_PER_SEC;
+        paused_ = true;
+    }
+    void resumeTiming() {
+        if (!paused_) return;
+        real_start_ = std::chrono::steady_clock::now();
+        cpu_start_ = std::clock();
+        paused_ = false;
+    }
+
+    long long range() const { return size_; }
+    long long iterations() const { return iterations_; }
+    void setItemsProcessed(long long items) { items_ = items; }
+    void setBytesProcessed(long long bytes) { bytes_ = bytes; }
+
+    long long itemsProcessed() const { return items_; }
+    long long bytesProcessed() const { return bytes_; }
+    double realNs() const { return real_ns_; }
+    double cpuNs() const { return cpu_ns_; }
+
+private:
+    long long size_, max_iterations_, iterations_, items_, bytes_;
+    bool paused_;
+    std::chrono::steady_clock::time_point real_start_;
+    std::clock_t cpu_start_;
+    double real_ns_, cpu_ns_;
+};
+
+typedef void (*BenchmarkFunction)(State&);
+
+struct Benchmark {
+    const char* name;
+    BenchmarkFunction function;
+    long long range_lo, range_hi;
+};
+
+const int MAX_BENCHMARKS = 64;
+
+inline Benchmark* registry() { static Benchmark list[MAX_BENCHMARKS]; return list; }
+inline int& registryCount() { static int count = 0; return count; }
+
+struct Registrar {
+    Registrar(const char* name, BenchmarkFunction function, long long lo, long long hi) {
+        if (registryCount() >= MAX_BENCHMARKS) { std::cerr << "Too many benchmarks registered\n"; std::abort(); }
+        Benchmark& b = registry()[registryCount()++];
+        b.name = name; b.function = function; b.range_lo = lo; b.range_hi = hi;
+    }
+};
+
+#define APUEC_BENCH_CONCAT2(a, b) a##b
+#define APUEC_BENCH_CONCAT(a, b) APUEC_BENCH_CONCAT2(a, b)
+// APUEC_BENCHMARK(BM_Name, 1000, 1000000) runs BM_Name at 1e3, 1e4, 1e5 and 1e6.
+#define APUEC_BENCHMARK(fn, lo, hi) \
+    static ::apuec_bench::Registrar APUEC_BENCH_CONCAT(apuec_bench_registrar_, __LINE__)(#fn, fn, lo, hi)
+
+// Points stdout at the null device while module code runs; restore() undoes it.
+class QuietStdout {
+public:
+    QuietStdout() : saved_(-1) {
+        std::fflush(stdout);
+        saved_ = dupFd(fileno(stdout));
+#if defined(_WIN32)
+        int null_fd = _open("NUL", _O_WRONLY);
+#else
+        int null_fd = open("/dev/null", O_WRONLY);
+#endif
+        if (null_fd >= 0) { dup2Fd(null_fd, fileno(stdout)); closeFd(null_fd); }
+        saved_cout_ = std::cout.rdbuf(nullptr);
+    }
+    ~QuietStdout() { restore(); }
+    void restore() {
+        if (saved_ < 0) return;
+        std::cout.rdbuf(saved_cout_);
+        std::fflush(stdout);
+        dup2Fd(saved_, fileno(stdout));
+        closeFd(saved_);
+        saved_ = -1;
+    }
+private:
+#if defined(_WIN32)
+    static int dupFd(int fd) { return _dup(fd); }
+    static int dup2Fd(int a, int b) { return _dup2(a, b); }
+    static int closeFd(int fd) { return _close(fd); }
+#else
+    static int dupFd(int fd) { return dup(fd); }
+    static int dup2Fd(int a, int b) { return dup2(a, b); }
+    static int closeFd(int fd) { return close(fd); }
+#endif
+    int saved_;
+    std::streambuf* saved_cout_;
+};
+
+inline void writeJsonEscaped(FILE* out, const char* s) {
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') std::fputc('\\', out);
+        std::fputc(*s, out);
+    }
+}
+
+inline int runBenchmarks(int argc, char** argv) {
+    const char* filter = "";
+    double min_time = 0.5;
+    char default_out[512];
+    const char* base = std::strrchr(argv[0], '/');
+    if (!base) base = std::strrchr(argv[0], '\\');
+    std::snprintf(default_out, sizeof(default_out), "%s.json", base ? base + 1 : argv[0]);
+    const char* out_path = default_out;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--benchmark_filter=", 19) == 0) filter = argv[i] + 19;
+        else if (std::strncmp(argv[i], "--benchmark_min_time=", 21) == 0) min_time = std::atof(argv[i] + 21);
+        else if (std::strncmp(argv[i], "--benchmark_out=", 16) == 0) out_path = argv[i] + 16;
+        else { std::cerr << "Unknown flag " << argv[i] << "\n"; return 1; }
+    }
+
+    FILE* json = std::fopen(out_path, "w");
+    if (!json) { std::cerr << "Cannot write " << out_path << "\n"; return 1; }
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    std::fprintf(json, "{\n  \"context\": {\n    \"date\": \"%s\",\n    \"executable\": \"", date);
+    writeJsonEscaped(json, argv[0]);
+    std::fprintf(json, "\",\n    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#ifdef NDEBUG
+    std::fprintf(json, "    \"library_build_type\": \"release\",\n");
+#else
+    std::fprintf(json, "    \"library_build_type\": \"debug\",\n");
+#endif
+    std::fprintf(json, "    \"min_time\": %g\n  },\n  \"benchmarks\": [", min_time);
+
+    std::printf("%-48s %14s %14s %12s %14s\n", "Benchmark", "Time (ns)", "CPU (ns)", "Iterations", "Items/s");
+    std::printf("%.*s\n", 106, "----------------------------------------------------------------------------------------------------------------");
+    int written = 0;
+    for (int b = 0; b < registryCount(); b++) {
+        const Benchmark& bench = registry()[b];
+        if (filter[0] && !std::strstr(bench.name, filter)) continue;
+        for (long long size = bench.range_lo; size <= bench.range_hi; size *= 10) {
+            char name[128];
+            std::snprintf(name, sizeof(name), "%s/%lld", bench.name, size);
+
+            // Grow the iteration count until one run lasts min_time, as Google Benchmark does.
+            long long iterations = 1;
+            State* state = nullptr;
+            while (true) {
+                delete state;
+                state = new State(size, iterations);
+                QuietStdout quiet;
+                bench.function(*state);
+                quiet.restore();
+                double seconds = state->realNs() / 1e9;
+                if (seconds >= min_time || iterations >= 1000000000LL) break;
+                double grow = seconds > 0 ? min_time * 1.4 / seconds : 10.0;
+                if (grow > 10.0) grow = 10.0;
+                long long next = (long long)(iterations * grow);
+                iterations = next > iterations ? next : iterations + 1;
+            }
+
+            double real_per_iter = state->realNs() / state->iterations();
+            double cpu_per_iter = state->cpuNs() / state->iterations();
+            double items_per_second = state->itemsProcessed() > 0 && state->realNs() > 0
+                                          ? state->itemsProcessed() / (state->realNs() / 1e9) : 0;
+            std::printf("%-48s %14.0f %14.0f %12lld %14.4g\n", name, real_per_iter, cpu_per_iter,
+                        state->iterations(), items_per_second);
+            std::fflush(stdout);
+
+            std::fprintf(json, "%s\n    {\n      \"name\": \"", written++ ? "," : "");
+            writeJsonEscaped(json, name);
+            std::fprintf(json, "\",\n      \"run_name\": \"");
+            writeJsonEscaped(json, name);
+            std::fprintf(json, "\",\n      \"run_type\": \"iteration\",\n      \"iterations\": %lld,\n"
+                               "      \"real_time\": %.3f,\n      \"cpu_time\": %.3f,\n      \"time_unit\": \"ns\"",
+                         state->iterations(), real_per_iter, cpu_per_iter);
+            if (items_per_second > 0) std::fprintf(json, ",\n      \"items_per_second\": %.6g", items_per_second);
+            if (state->bytesProcessed() > 0 && state->realNs() > 0)
+                std::fprintf(json, ",\n      \"bytes_per_second\": %.6g", state->bytesProcessed() / (state->realNs() / 1e9));
+            std::fprintf(json, "\n    }");
+            delete state;
+        }
+    }
+    std::fprintf(json, "\n  ]\n}\n");
+    std::fclose(json);
+    std::printf("\nResults written to %s\n", out_path);
+    return 0;
+}
+
+} // namespace apuec_bench
+
+#endif // APUEC_BENCH_HARNESS_HPP
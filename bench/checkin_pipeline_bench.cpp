@@ -0,0 +1,138 @@
+// Check-in pipeline benchmark.
+// Sixteen desk threads (by default) check players in two ways:
+//   synchronous  a shared lock around Task2_checkInByID plus a CSV rewrite per
+//                check-in, which is what Task2_checkInPlayer does for one desk
+//   pipeline     Task2_CheckInPipeline::submit into the lock-free ring, with the
+//                applier batching into the registry and the check-in log
+// and reports throughput and the desk-side latency of each check-in. Pipeline
+// throughput counts until stop() has drained the ring and saved the CSV.
+//
+// Built by the CMake project (`cmake --build build --target bench` runs it), or from the repository root:
+//   g++ -std=c++17 -O2 -pthread bench/checkin_pipeline_bench.cpp src/*.cpp -o checkin_pipeline_bench
+//   ./checkin_pipeline_bench [checkins] [players] [producers]
+//   (defaults 1000000, 20000, 16; files go to the current directory and are removed)
+
+#include "../EsportsChampionship.hpp"
+#include <mutex>
+
+static const char* const BENCH_CSV = "checkin_bench_registry.csv";
+static const char* const BENCH_LOG = "checkin_bench_registry.log";
+static const int BENCH_SYNC_CHECKINS = 400; // Each one rewrites the whole CSV
+
+static void buildRegistry(struct Task2_PriorityQueue* pq, int players) {
+    const char* types[4] = {"Early-Bird", "Standard", "Wildcard", "Last-Minute"};
+    char name[32], email[48];
+    pq->init();
+    for (int i = 0; i < players; i++) {
+        snprintf(name, sizeof(name), "Player %d", 1001 + i);
+        snprintf(email, sizeof(email), "player%d@example.com", 1001 + i);
+        Task2_addPlayer(pq, 1001 + i, name, types[i % 4], email);
+    }
+}
+
+// Desk traffic: mostly registered players, some repeats, about 2% unknown IDs.
+static void pickID(uint64_t& rng, int players, char* id, size_t size) {
+    rng ^= rng >> 12; rng ^= rng << 25; rng ^= rng >> 27;
+    uint64_t r = rng * 2685821657736338717ULL;
+    int offset = (int)((r >> 8) % (uint64_t)(players + players / 50 + 1));
+    snprintf(id, size, "%d", 1001 + offset);
+}
+
+static void printLatency(const char* label, const LatencyHistogram& latency) {
+    printf("  %-12s desk latency us: p50 %.2f  p99 %.2f  p99.9 %.2f  max %.1f\n", label,
+           latency.percentile(50) / 1000.0, latency.percentile(99) / 1000.0,
+           latency.percentile(99.9) / 1000.0, latency.max() / 1000.0);
+}
+
+template <typename Desk>
+static double runDesks(int producers, long long total, Desk desk) {
+    std::thread* threads = new std::thread[producers];
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int t = 0; t < producers; t++) {
+        long long share = total / producers + (t < total % producers ? 1 : 0);
+        threads[t] = std::thread(desk, t, share);
+    }
+    for (int t = 0; t < producers; t++) threads[t].join();
+    delete[] threads;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    long long checkins = argc > 1 ? atoll(argv[1]) : 1000000;
+    int players = argc > 2 ? atoi(argv[2]) : 20000;
+    int producers = argc > 3 ? atoi(argv[3]) : 16;
+    if (checkins <= 0 || players <= 0 || producers <= 0 || producers > 1024) {
+        std::cerr << "checkins and players must be positive, producers 1..1024\n";
+        return 1;
+    }
+    printf("%d players, %d desk threads\n", players, producers);
+
+    // Synchronous: one lock, an O(n) queue walk and a full CSV rewrite per check-in.
+    {
+        struct Task2_PriorityQueue pq;
+        buildRegistry(&pq, players);
+        LatencyHistogram* latency = new LatencyHistogram();
+        std::mutex registry_lock;
+        long long total = checkins < BENCH_SYNC_CHECKINS ? checkins : BENCH_SYNC_CHECKINS;
+        double seconds = runDesks(producers, total, [&](int t, long long share) {
+            uint64_t rng = 0x9E3779B97F4A7C15ULL * (uint64_t)(t + 1);
+            char id[16];
+            for (long long i = 0; i < share; i++) {
+                pickID(rng, players, id, sizeof(id));
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                {
+                    std::lock_guard<std::mutex> guard(registry_lock);
+                    if (Task2_checkInByID(&pq, id)) Task2_writePlayersToCSV(&pq, BENCH_CSV);
+                }
+                latency->record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+            }
+        });
+        printf("synchronous: %lld check-ins in %.3f s: %.0f check-ins/s\n", total, seconds, total / seconds);
+        printLatency("synchronous", *latency);
+        delete latency;
+        Task2_destroyRegistry(&pq);
+    }
+
+    // Pipeline: desks only touch the ring.
+    {
+        struct Task2_PriorityQueue pq;
+        buildRegistry(&pq, players);
+        remove(BENCH_LOG);
+        LatencyHistogram* latency = new LatencyHistogram();
+        std::atomic<long long> full_retries(0);
+        Task2_CheckInPipeline pipeline;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        if (!pipeline.start(&pq, BENCH_CSV, BENCH_LOG)) {
+            std::cerr << "pipeline failed to start\n";
+            return 1;
+        }
+        double desk_seconds = runDesks(producers, checkins, [&](int t, long long share) {
+            uint64_t rng = 0x9E3779B97F4A7C15ULL * (uint64_t)(t + 1);
+            char id[16];
+            long long retries = 0;
+            for (long long i = 0; i < share; i++) {
+                pickID(rng, players, id, sizeof(id));
+                std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+                while (!pipeline.submit(id)) { retries++; std::this_thread::yield(); } // Ring full: back off
+                latency->record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - begin).count());
+            }
+            full_retries.fetch_add(retries);
+        });
+        pipeline.stop();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("pipeline:    %lld check-ins in %.3f s: %.0f check-ins/s (desks done after %.3f s)\n",
+               checkins, seconds, checkins / seconds, desk_seconds);
+        printLatency("pipeline", *latency);
+        printf("  applied %lld, already checked in %lld, unknown %lld, %lld batches (%.1f per batch), %lld full-ring retries\n",
+               pipeline.applied(), pipeline.duplicates(), pipeline.unknown(), pipeline.batches(),
+               pipeline.batches() ? (double)checkins / pipeline.batches() : 0.0, full_retries.load());
+        delete latency;
+        Task2_destroyRegistry(&pq);
+    }
+
+    remove(BENCH_CSV);
+    remove(BENCH_LOG);
+    return 0;
+}
@@ -0,0 +1,353 @@
+// Micro-benchmarks for the queues, stacks and CSV loaders of every task.
+// Each benchmark runs at powers of ten from 1e3 up to 1e7. Structures with
+// O(n) inserts stop lower, since their n^2 total makes larger sizes take
+// minutes: PlayerPriorityQueue, PrioritySeatingQueue, SpectatorList, and
+// the loaders built on them. Inputs come from the seeded generators
+// below, so every run measures the same data. Results go to a JSON file (see
+// bench_harness.hpp for the flags).
+//
+// Built by the CMake project (`cmake --build build --target bench` runs it), or from the repository root:
+//   g++ -std=c++17 -O2 bench/data_structures_bench.cpp src/*.cpp -o data_structures_bench
+//   ./data_structures_bench [--benchmark_filter=Task4] [--benchmark_out=results.json]
+// The loader benchmarks write their CSV inputs to the current directory and remove them afterwards.
+
+#include "../EsportsChampionship.hpp"
+#include "bench_harness.hpp"
+
+using apuec_bench::State;
+
+// -------- Synthetic data --------
+// xorshift64*: fixed seed per generator, so every run sees the same rows.
+struct BenchRng {
+    uint64_t state;
+    explicit BenchRng(uint64_t seed) : state(seed ? seed : 1) {}
+    uint64_t next() {
+        state ^= state >> 12; state ^= state << 25; state ^= state >> 27;
+        return state * 2685821657736338717ULL;
+    }
+    int below(int n) { return (int)(next() % (uint64_t)n); }
+};
+
+static const char* const BENCH_REG_TYPES[4] = {"Early-Bird", "Wildcard", "Standard", "Last-Minute"};
+static const char* const BENCH_REG_RANKS[4] = {"A", "B", "C", "D"}; // Task 2's rank per registration type
+static const char* const BENCH_CATEGORIES[3] = {"VIP", "Influencer", "General"};
+
+static int benchRegType(BenchRng& rng) { // 20% Early-Bird, 10% Wildcard, 55% Standard, 15% Last-Minute
+    int r = rng.below(100);
+    return r < 20 ? 0 : r < 30 ? 1 : r < 85 ? 2 : 3;
+}
+
+static void benchCheckInTime(BenchRng& rng, char* buf, size_t size) {
+    snprintf(buf, size, "2025-05-%02d %02d:%02d", 18 + rng.below(3), 8 + rng.below(12), rng.below(60));
+}
+
+// Player_Registration.csv as Task 2 writes it; Task 1 and Task 4 read the same columns.
+static long long writeRegistrationCSV(const char* path, long long n) {
+    BenchRng rng(0x5eed0001);
+    BufferedWriter out;
+    out.open(path);
+    out.write("Player ID,Player Name,Registration Type,Email,Rank,Check-In,Time of Check-In,Status\n");
+    char when[24];
+    for (long long i = 0; i < n; i++) {
+        int type = benchRegType(rng);
+        bool checked_in = rng.below(100) < 80;
+        benchCheckInTime(rng, when, sizeof(when));
+        out.writeInt(1000 + i); out.write(",Player "); out.writeInt(1000 + i); out.put(',');
+        out.write(BENCH_REG_TYPES[type]); out.write(",player"); out.writeInt(1000 + i); out.write("@apu.edu.my,");
+        out.write(BENCH_REG_RANKS[type]); out.put(',');
+        out.write(checked_in ? "YES," : "NO,");
+        out.write(checked_in ? when : "N/A"); out.write(",MAIN\n");
+    }
+    long long bytes = (long long)out.bytesWritten();
+    out.close();
+    return bytes;
+}
+
+// matches.csv: completed matches between players 1000..1000+players-1, spread over 30 days.
+static long long writeMatchesCSV(const char* path, long long n, int players) {
+    static const char* const stages[3] = {"group", "knockout", "final"};
+    BenchRng rng(0x5eed0002);
+    BufferedWriter out;
+    out.open(path);
+    out.write("match_id,stage,group_id,round,player1_id,player2_id,scheduled_time,status,winner_id,score\n");
+    char when[32]; // Sized for any int day/hour, so the format cannot truncate
+    for (long long i = 0; i < n; i++) {
+        int p1 = 1000 + rng.below(players), p2 = 1000 + rng.below(players);
+        int s1 = rng.below(25), s2 = rng.below(25);
+        snprintf(when, sizeof(when), "2025-05-%02d %02d:00:00", 1 + (int)(i * 30 / n), 8 + rng.below(12));
+        out.writeInt(i + 1); out.put(','); out.write(stages[rng.below(3)]); out.put(',');
+        out.writeInt(1 + rng.below(10)); out.put(','); out.writeInt(1 + rng.below(2)); out.put(',');
+        out.writeInt(p1); out.put(','); out.writeInt(p2); out.put(','); out.write(when); out.write(",completed,");
+        out.writeInt(s1 >= s2 ? p1 : p2); out.put(','); out.writeInt(s1); out.put('-'); out.writeInt(s2); out.put('\n');
+    }
+    long long bytes = (long long)out.bytesWritten();
+    out.close();
+    return bytes;
+}
+
+static long long writeSpectatorsCSV(const char* path, long long n) {
+    BenchRng rng(0x5eed0003);
+    BufferedWriter out;
+    out.open(path);
+    out.write("spectator_id,name,category,wants_live_stream,supported_player,day,payment_amount\n");
+    char id[24];
+    for (long long i = 0; i < n; i++) {
+        int category = rng.below(10) < 1 ? 0 : rng.below(10) < 2 ? 1 : 2;
+        snprintf(id, sizeof(id), "S%05lld", i + 1);
+        out.write(id); out.write(",Viewer "); out.writeInt(i + 1); out.put(',');
+        out.write(BENCH_CATEGORIES[category]); out.write(rng.below(2) ? ",Yes," : ",No,");
+        out.writeInt(1000 + rng.below(1000)); out.write(",2025-05-"); out.writeInt(18 + rng.below(3)); out.put(',');
+        out.writeInt(category == 0 ? 500 : category == 1 ? 350 : 200); out.put('\n');
+    }
+    long long bytes = (long long)out.bytesWritten();
+    out.close();
+    return bytes;
+}
+
+static Task3::Spectator** makeSpectators(long long n) {
+    BenchRng rng(0x5eed0004);
+    Task3::Spectator** pool = new Task3::Spectator*[n];
+    for (long long i = 0; i < n; i++) {
+        pool[i] = new Task3::Spectator("S" + std::to_string(i + 1), "Viewer", true, "1001",
+                                       BENCH_CATEGORIES[rng.below(3)], "2025-05-20");
+    }
+    return pool;
+}
+
+static void freeSpectators(Task3::Spectator** pool, long long n) {
+    for (long long i = 0; i < n; i++) delete pool[i];
+    delete[] pool;
+}
+
+// -------- Task 1 --------
+static void BM_MatchQueue_EnqueueDequeue(State& state) {
+    long long n = state.range();
+    Match* pool[64];
+    for (int i = 0; i < 64; i++) pool[i] = new Match(i + 1, nullptr, nullptr, "group", 1, 1);
+    MatchQueue queue;
+    while (state.keepRunning()) {
+        for (long long i = 0; i < n; i++) queue.enqueue(pool[i & 63]);
+        while (!queue.isEmpty()) queue.dequeue();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    for (int i = 0; i < 64; i++) delete pool[i];
+}
+APUEC_BENCHMARK(BM_MatchQueue_EnqueueDequeue, 1000, 10000000);
+
+// Sorted-list insert by check-in time: O(n) per enqueue.
+static void BM_PlayerPriorityQueue_EnqueueDequeue(State& state) {
+    long long n = state.range();
+    BenchRng rng(0x5eed0005);
+    Player** players = new Player*[n];
+    char when[24];
+    for (long long i = 0; i < n; i++) {
+        players[i] = new Player((int)(1000 + i), "Player", "A", "Standard", 0, "p@apu.edu.my", 0, true);
+        benchCheckInTime(rng, when, sizeof(when));
+        players[i]->setCheckIn(true, when);
+    }
+    PlayerPriorityQueue queue;
+    while (state.keepRunning()) {
+        for (long long i = 0; i < n; i++) queue.enqueue(players[i]);
+        while (!queue.isEmpty()) queue.dequeue();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    for (long long i = 0; i < n; i++) delete players[i];
+    delete[] players;
+}
+APUEC_BENCHMARK(BM_PlayerPriorityQueue_EnqueueDequeue, 1000, 10000);
+
+static void BM_Tournament_Initialize(State& state) {
+    long long n = state.range();
+    char path[64];
+    snprintf(path, sizeof(path), "bench_registration_%lld.csv", n);
+    long long bytes = writeRegistrationCSV(path, n);
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Tournament* tournament = new Tournament((int)n);
+        state.resumeTiming();
+        tournament->initialize(path);
+        state.pauseTiming();
+        delete tournament;
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    state.setBytesProcessed(state.iterations() * bytes);
+    remove(path);
+}
+APUEC_BENCHMARK(BM_Tournament_Initialize, 1000, 10000);
+
+// -------- Task 2 --------
+static void BM_Task2_PriorityQueue_EnqueueDequeue(State& state) {
+    long long n = state.range();
+    BenchRng rng(0x5eed0006);
+    Task2_Player* players = new Task2_Player[n];
+    for (long long i = 0; i < n; i++) {
+        memset(&players[i], 0, sizeof(Task2_Player));
+        snprintf(players[i].playerID, sizeof(players[i].playerID), "%u", (unsigned)((1000 + i) % 1000000000)); // Nine digits fit playerID
+        strcpy(players[i].registrationType, BENCH_REG_TYPES[benchRegType(rng)]);
+    }
+    Task2_PriorityQueue queue;
+    queue.init();
+    while (state.keepRunning()) {
+        for (long long i = 0; i < n; i++) queue.enqueue(&players[i]);
+        while (!queue.isEmpty()) queue.dequeue();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    delete[] players;
+}
+APUEC_BENCHMARK(BM_Task2_PriorityQueue_EnqueueDequeue, 1000, 10000000);
+
+static void BM_Task2_ReadPlayersFromCSV(State& state) {
+    long long n = state.range();
+    char path[64];
+    snprintf(path, sizeof(path), "bench_registration_%lld.csv", n);
+    long long bytes = writeRegistrationCSV(path, n);
+    while (state.keepRunning()) {
+        Task2_PriorityQueue queue;
+        queue.init();
+        Task2_readPlayersFromCSV(&queue, path);
+        state.pauseTiming();
+        queue.earlyBirdQueue.destroy();
+        queue.wildcardQueue.destroy();
+        queue.standardQueue.destroy();
+        queue.lastMinuteQueue.destroy();
+        queue.waitlistQueue.destroy();
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    state.setBytesProcessed(state.iterations() * bytes);
+    remove(path);
+}
+APUEC_BENCHMARK(BM_Task2_ReadPlayersFromCSV, 1000, 1000000);
+
+// -------- Task 3 --------
+// Sorted-list insert by category: O(n) per enqueue.
+static void BM_PrioritySeatingQueue_Enqueue(State& state) {
+    long long n = state.range();
+    Task3::Spectator** pool = makeSpectators(n);
+    while (state.keepRunning()) {
+        Task3::PrioritySeatingQueue* queue = new Task3::PrioritySeatingQueue();
+        for (long long i = 0; i < n; i++) queue->enqueue(pool[i]);
+        state.pauseTiming();
+        delete queue;
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    freeSpectators(pool, n);
+}
+APUEC_BENCHMARK(BM_PrioritySeatingQueue_Enqueue, 1000, 10000);
+
+// n rotations through a full 100-viewer rotation: dequeue the front, enqueue it at the back.
+static void BM_CircularStreamRotation_Rotate(State& state) {
+    long long n = state.range();
+    Task3::Spectator** pool = makeSpectators(100);
+    Task3::CircularStreamRotation rotation(100);
+    for (int i = 0; i < 100; i++) rotation.enqueue(pool[i]);
+    while (state.keepRunning()) {
+        for (long long i = 0; i < n; i++) rotation.enqueue(rotation.dequeue());
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    while (!rotation.isEmpty()) rotation.dequeue();
+    freeSpectators(pool, 100);
+}
+APUEC_BENCHMARK(BM_CircularStreamRotation_Rotate, 1000, 10000000);
+
+// SpectatorList::append walks to the tail, so loading is O(n^2).
+static void BM_Task3_SpectatorList_LoadFromCSV(State& state) {
+    long long n = state.range();
+    char path[64];
+    snprintf(path, sizeof(path), "bench_spectators_%lld.csv", n);
+    long long bytes = writeSpectatorsCSV(path, n);
+    Task3::SpectatorList list;
+    while (state.keepRunning()) list.loadFromCSV(path); // Clears the previous load first
+    state.setItemsProcessed(state.iterations() * n);
+    state.setBytesProcessed(state.iterations() * bytes);
+    remove(path);
+}
+APUEC_BENCHMARK(BM_Task3_SpectatorList_LoadFromCSV, 1000, 10000);
+
+static void BM_Task3_MatchList_LoadFromCSV(State& state) {
+    long long n = state.range();
+    char path[64];
+    snprintf(path, sizeof(path), "bench_matches_%lld.csv", n);
+    long long bytes = writeMatchesCSV(path, n, 1000);
+    Task3::MatchList list;
+    while (state.keepRunning()) list.loadFromCSV(path);
+    state.setItemsProcessed(state.iterations() * n);
+    state.setBytesProcessed(state.iterations() * bytes);
+    remove(path);
+}
+APUEC_BENCHMARK(BM_Task3_MatchList_LoadFromCSV, 1000, 1000000);
+
+// -------- Task 4 --------
+// n pushes through the fixed-capacity ring (evicting the oldest once full), then pop what is left.
+static void BM_Task4_Stack_PushPop(State& state) {
+    long long n = state.range();
+    Task4_MatchResult match(1, "group", 1, 1, 1001, 1002, "2025-05-20 10:00:00", "completed", 1001, "18-15");
+    Task4_MatchResult out;
+    Task4_Stack stack;
+    while (state.keepRunning()) {
+        for (long long i = 0; i < n; i++) stack.pushEvictOldest(match);
+        while (stack.pop(out)) {}
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+APUEC_BENCHMARK(BM_Task4_Stack_PushPop, 1000, 10000000);
+
+static void BM_Task4_Queue_EnqueueDequeue(State& state) {
+    long long n = state.range();
+    Task4_MatchResult match(1, "group", 1, 1, 1001, 1002, "2025-05-20 10:00:00", "completed", 1001, "18-15");
+    Task4_MatchResult out;
+    Task4_Queue queue;
+    while (state.keepRunning()) {
+        for (long long i = 0; i < n; i++) {
+            if (queue.size() == TASK4_MAX_CAPACITY) queue.dequeue(out);
+            queue.enqueue(match);
+        }
+        while (queue.dequeue(out)) {}
+    }
+    state.setItemsProcessed(state.iterations() * n);
+}
+APUEC_BENCHMARK(BM_Task4_Queue_EnqueueDequeue, 1000, 10000000);
+
+static void BM_Task4_LoadPlayerData(State& state) {
+    long long n = state.range();
+    char path[64];
+    snprintf(path, sizeof(path), "bench_registration_%lld.csv", n);
+    long long bytes = writeRegistrationCSV(path, n);
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Task4_GameResultManager* manager = new Task4_GameResultManager((int)n);
+        state.resumeTiming();
+        manager->loadPlayerData(path);
+        state.pauseTiming();
+        delete manager;
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    state.setBytesProcessed(state.iterations() * bytes);
+    remove(path);
+}
+APUEC_BENCHMARK(BM_Task4_LoadPlayerData, 1000, 1000000);
+
+// Match history for 1000 registered players; the load includes the stats rebuild.
+static void BM_Task4_LoadMatchHistory(State& state) {
+    long long n = state.range();
+    char players_path[64], matches_path[64];
+    snprintf(players_path, sizeof(players_path), "bench_registration_%d.csv", 1000);
+    snprintf(matches_path, sizeof(matches_path), "bench_matches_%lld.csv", n);
+    writeRegistrationCSV(players_path, 1000);
+    long long bytes = writeMatchesCSV(matches_path, n, 1000);
+    Task4_GameResultManager manager(1000);
+    manager.loadPlayerData(players_path);
+    while (state.keepRunning()) manager.loadMatchHistory(matches_path); // Clears the previous load first
+    state.setItemsProcessed(state.iterations() * n);
+    state.setBytesProcessed(state.iterations() * bytes);
+    remove(players_path);
+    remove(matches_path);
+}
+APUEC_BENCHMARK(BM_Task4_LoadMatchHistory, 1000, 1000000);
+
+int main(int argc, char** argv) {
+    return apuec_bench::runBenchmarks(argc, argv);
+}
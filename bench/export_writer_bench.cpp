@@ -0,0 +1,108 @@
+// Export writer benchmark.
+// Writes the same synthetic match table as matches.csv three ways: field by
+// field through ofstream << (how Tournament::saveMatchesToCSV wrote it),
+// field by field through fprintf (Task 2's style), and through BufferedWriter.
+// It then times the JSON Lines and columnar exports of the same rows.
+//
+// Built by the CMake project (`cmake --build build --target bench` runs it), or from the repository root:
+//   g++ -std=c++17 -O2 bench/export_writer_bench.cpp src/*.cpp -o export_writer_bench
+//   ./export_writer_bench [rows]   (default 1000000; files go to the current directory and are removed)
+
+#include "../EsportsChampionship.hpp"
+#include <chrono>
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static long long fileBytes(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    fseek(f, 0, SEEK_END);
+    long long bytes = ftell(f);
+    fclose(f);
+    return bytes;
+}
+
+int main(int argc, char** argv) {
+    int rows = argc > 1 ? atoi(argv[1]) : 1000000;
+    const char* stages[3] = {"group", "knockout", "final"};
+    if (rows <= 0) { std::cerr << "rows must be positive\n"; return 1; }
+
+    srand(42);
+    Task4_MatchTable table;
+    table.reserve(rows);
+    char when[32], score[16];
+    for (int i = 0; i < rows; i++) {
+        int p1 = 1 + rand() % 1000, p2 = 1 + rand() % 1000;
+        snprintf(when, sizeof(when), "2025-%02d-%02d %02d:00:00", 1 + i % 12, 1 + i % 28, i % 24);
+        snprintf(score, sizeof(score), "%d-%d", rand() % 30, rand() % 30);
+        table.append(i + 1, stages[i % 3], 1 + i % 50, 1 + i % 3, p1, p2, when, "completed", p1, score);
+    }
+
+    std::chrono::steady_clock::time_point t = std::chrono::steady_clock::now();
+    {
+        std::ofstream file("bench_ofstream.csv");
+        file << "match_id,stage,group_id,round,player1_id,player2_id,scheduled_time,status,winner_id,score\n";
+        for (int row = 0; row < rows; row++) {
+            file << table.matchId(row) << "," << table.stageName(row) << "," << table.groupId(row) << ","
+                 << table.round(row) << "," << table.player1Id(row) << "," << table.player2Id(row) << ","
+                 << table.scheduledTime(row) << "," << table.statusName(row) << "," << table.winnerId(row) << ","
+                 << table.scoreText(row) << "\n";
+        }
+    }
+    double ofstream_ms = elapsedMs(t);
+
+    t = std::chrono::steady_clock::now();
+    {
+        FILE* file = fopen("bench_fprintf.csv", "w");
+        fprintf(file, "match_id,stage,group_id,round,player1_id,player2_id,scheduled_time,status,winner_id,score\n");
+        for (int row = 0; row < rows; row++) {
+            fprintf(file, "%d,", table.matchId(row));
+            fprintf(file, "%s,", table.stageName(row).c_str());
+            fprintf(file, "%d,", table.groupId(row));
+            fprintf(file, "%d,", table.round(row));
+            fprintf(file, "%d,", table.player1Id(row));
+            fprintf(file, "%d,", table.player2Id(row));
+            fprintf(file, "%s,", table.scheduledTime(row).c_str());
+            fprintf(file, "%s,", table.statusName(row).c_str());
+            fprintf(file, "%d,", table.winnerId(row));
+            fprintf(file, "%s\n", table.scoreText(row).c_str());
+        }
+        fclose(file);
+    }
+    double fprintf_ms = elapsedMs(t);
+
+    BufferedWriter out;
+    t = std::chrono::steady_clock::now();
+    out.open("bench_writer.csv");
+    table.writeCSV(out);
+    out.close();
+    double writer_csv_ms = elapsedMs(t);
+
+    t = std::chrono::steady_clock::now();
+    out.open("bench_writer.jsonl");
+    table.writeJSONLines(out);
+    out.close();
+    double writer_jsonl_ms = elapsedMs(t);
+
+    t = std::chrono::steady_clock::now();
+    out.open("bench_writer.col");
+    table.writeColumnar(out);
+    out.close();
+    double writer_columnar_ms = elapsedMs(t);
+
+    std::cout << "Rows: " << rows << "\n"
+              << "CSV, ofstream per field:  " << ofstream_ms << " ms (" << fileBytes("bench_ofstream.csv") << " bytes)\n"
+              << "CSV, fprintf per field:   " << fprintf_ms << " ms (" << fileBytes("bench_fprintf.csv") << " bytes)\n"
+              << "CSV, BufferedWriter:      " << writer_csv_ms << " ms (" << fileBytes("bench_writer.csv") << " bytes)\n"
+              << "JSON Lines, BufferedWriter: " << writer_jsonl_ms << " ms (" << fileBytes("bench_writer.jsonl") << " bytes)\n"
+              << "Columnar, BufferedWriter:   " << writer_columnar_ms << " ms (" << fileBytes("bench_writer.col") << " bytes)\n";
+
+    remove("bench_ofstream.csv");
+    remove("bench_fprintf.csv");
+    remove("bench_writer.csv");
+    remove("bench_writer.jsonl");
+    remove("bench_writer.col");
+    return 0;
+}
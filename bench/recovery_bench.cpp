@@ -0,0 +1,141 @@
+// Tournament recovery benchmark.
+// Writes a checkpoint of a tournament with every group semifinal scheduled and a
+// journal of the events that play it to the end (N dequeue / R result pairs, about
+// six per group), then times Tournament::openJournal on them:
+//   replay      restore the base checkpoint and replay the whole journal
+//   checkpoint  restore the checkpoint openJournal wrote after that replay
+// Recovery is bounded by the checkpoint interval: at most that many events are
+// ever replayed on top of a checkpoint, so the worst case is printed as
+// checkpoint restore + interval x replay cost per event. It also times a synced
+// journal append, the per-event cost the interval trades against.
+//
+// Built by the CMake project (`cmake --build build --target bench` runs it), or from the repository root:
+//   g++ -std=c++17 -O2 -pthread bench/recovery_bench.cpp src/*.cpp -o recovery_bench
+//   ./recovery_bench [events] [checkpoint-interval]   (defaults 1000000, 64)
+// Like the application it writes matches.csv and brackets.csv, so run it from a scratch
+// directory (the bench target uses the build directory); the files it writes are removed.
+
+#include "../EsportsChampionship.hpp"
+
+static const char* const BENCH_CHECKPOINT = "recovery_bench_state.chk";
+static const char* const BENCH_JOURNAL = "recovery_bench_events.log";
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The layout Tournament::writeCheckpoint documents: 4 players per group, both
+// semifinals of every group queued, nothing played yet.
+static bool writeBaseCheckpoint(int groups) {
+    BufferedWriter out;
+    if (!out.open(BENCH_CHECKPOINT)) return false;
+    out.write("APUEC-TOURNAMENT-CHECKPOINT 1\nsequence\t0\nstate\t");
+    out.writeInt(2LL * groups + 1); out.write("\t0\t1\t1\t0\n");
+    out.write("players\t"); out.writeInt(4LL * groups); out.put('\n');
+    for (int i = 0; i < 4 * groups; i++) {
+        out.writeInt(1001 + i); out.write("\tPlayer "); out.writeInt(1001 + i);
+        out.write("\tA\tStandard\tgroup\t0\t0\t"); out.writeInt(i / 4 + 1); out.write("\t1\t2025-06-01 09:00\n");
+    }
+    out.write("groups\t"); out.writeInt(groups); out.put('\n');
+    for (int g = 0; g < groups; g++) {
+        out.writeInt(g + 1); out.write("\tA\tStandard\t0\t0\t-1\t4");
+        for (int k = 0; k < 4; k++) { out.put('\t'); out.writeInt(4LL * g + k); }
+        out.put('\n');
+    }
+    out.write("matches\t"); out.writeInt(2LL * groups); out.put('\n');
+    for (int g = 0; g < groups; g++) { // Player 0 vs 3 and 1 vs 2, as Group::createSemifinalsOnly pairs them
+        for (int s = 0; s < 2; s++) {
+            out.writeInt(2LL * g + s + 1); out.write("\tgroup\t"); out.writeInt(g + 1); out.write("\t1\t");
+            out.writeInt(4LL * g + s); out.put('\t'); out.writeInt(4LL * g + 3 - s);
+            out.write("\t-1\tscheduled\t0-0\t2025-06-01 10:00\n");
+        }
+    }
+    out.write("upcoming\t"); out.writeInt(2LL * groups); out.put('\n');
+    for (int i = 0; i < 2 * groups; i++) { out.writeInt(i); out.put('\n'); }
+    out.write("winners\t0\ncheckin\t0\nend\n");
+    return out.close();
+}
+
+// Plays every match in queue order with player 1 winning: all semifinals, the group
+// finals they create, then the knockout semifinals and the final.
+static long long writeJournal(int groups) {
+    BufferedWriter out;
+    if (!out.open(BENCH_JOURNAL)) return -1;
+    long long sequence = 0, at = (long long)time(nullptr);
+    int matches = 3 * groups + 3;
+    for (int id = 1; id <= matches; id++) {
+        Tournament::writeJournalEvent(out, ++sequence, 'N', id, 0, at);
+        Tournament::writeJournalEvent(out, ++sequence, 'R', id, 1, at);
+    }
+    return out.close() ? sequence : -1;
+}
+
+// Opens the journal on a tournament sized for the benchmark and checks where it ended up.
+static double recover(int groups, int interval, bool* complete) {
+    Tournament* tournament = new Tournament(4 * groups, 3 * groups + 3, groups, groups);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool restored = tournament->openJournal(BENCH_CHECKPOINT, BENCH_JOURNAL, interval, false);
+    double ms = elapsedMs(start);
+    {
+        TournamentSnapshotRef snapshot(*tournament);
+        *complete = restored && snapshot->totalMatchesPlayed == 3 * groups + 3 &&
+                    strcmp(snapshot->stageDescription(), "Tournament Completed") == 0;
+    }
+    delete tournament;
+    return ms;
+}
+
+int main(int argc, char** argv) {
+    long long events = argc > 1 ? atoll(argv[1]) : 1000000;
+    int interval = argc > 2 ? atoi(argv[2]) : 64;
+    if (events < 30 || interval <= 0) { std::cerr << "events must be at least 30 and the interval positive\n"; return 1; }
+    FILE* existing = fopen("matches.csv", "rb");
+    if (existing) {
+        fclose(existing);
+        std::cerr << "matches.csv exists here; run the benchmark from a scratch directory.\n";
+        return 1;
+    }
+    int groups = (int)((events - 6) / 6);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    long long logged = writeBaseCheckpoint(groups) ? writeJournal(groups) : -1;
+    if (logged < 0) { std::cerr << "could not write the benchmark files\n"; return 1; }
+    printf("%d groups, %d players; %lld journal events written in %.0f ms\n", groups, 4 * groups, logged, elapsedMs(start));
+
+    bool complete = false;
+    double replayMs = recover(groups, interval, &complete);
+    if (!complete) { std::cerr << "replay did not finish the tournament\n"; return 1; }
+    printf("replay:     restore + %lld events + CSVs + new checkpoint: %.0f ms\n", logged, replayMs);
+
+    double checkpointMs = recover(groups, interval, &complete); // The checkpoint written above, with an empty journal
+    if (!complete) { std::cerr << "restore from the new checkpoint lost state\n"; return 1; }
+    printf("checkpoint: restore + CSVs + new checkpoint:            %.0f ms\n", checkpointMs);
+
+    double perEventUs = replayMs > checkpointMs ? (replayMs - checkpointMs) * 1000.0 / logged : 0.0;
+    printf("replay cost %.2f us/event; worst case with a checkpoint every %d events: %.0f ms + %.2f ms\n",
+           perEventUs, interval, checkpointMs, interval * perEventUs / 1000.0);
+
+    // What each live event pays for durability.
+    const int appends = 1000;
+    BufferedWriter out(64 * 1024);
+    if (out.open(BENCH_JOURNAL)) {
+        LatencyHistogram* latency = new LatencyHistogram();
+        for (int i = 0; i < appends; i++) {
+            std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+            Tournament::writeJournalEvent(out, i + 1, 'R', i + 1, 1, 0);
+            out.sync();
+            latency->record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - begin).count());
+        }
+        out.close();
+        printf("synced journal append: p50 %.1f us  p99 %.1f us\n", latency->percentile(50) / 1000.0,
+               latency->percentile(99) / 1000.0);
+        delete latency;
+    }
+
+    remove(BENCH_CHECKPOINT);
+    remove(BENCH_JOURNAL);
+    remove("matches.csv");
+    remove("brackets.csv");
+    return 0;
+}
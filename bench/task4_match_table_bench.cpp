@@ -0,0 +1,112 @@
+// Task 4 match table benchmark.
+// Fills Task4_MatchTable with synthetic matches and times the two history
+// queries against the same scan over an array of Task4_MatchResult rows,
+// which is how the records were held before. By player uses the posting
+// lists; by stage and the compound filter use the bitmap indexes. It also
+// times one full re-aggregation of per-player totals.
+//
+// Built by the CMake project (`cmake --build build --target bench` runs it), or from the repository root:
+//   g++ -std=c++17 -O2 bench/task4_match_table_bench.cpp src/*.cpp -o task4_match_table_bench
+//   ./task4_match_table_bench [rows]   (default 10000000)
+
+#include "../EsportsChampionship.hpp"
+#include <chrono>
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int rows = argc > 1 ? atoi(argv[1]) : 10000000;
+    const int players = 1000;
+    const int queries = 20;
+    const char* stages[3] = {"group", "knockout", "final"};
+    if (rows <= 0) { std::cerr << "rows must be positive\n"; return 1; }
+
+    srand(42);
+    Task4_MatchTable table;
+    Task4_MatchResult* row_store = new Task4_MatchResult[rows];
+    table.reserve(rows);
+
+    std::chrono::steady_clock::time_point t = std::chrono::steady_clock::now();
+    char when[32], score[16];
+    for (int i = 0; i < rows; i++) {
+        int p1 = 1 + rand() % players, p2 = 1 + rand() % players;
+        const char* stage = stages[i % 10 == 0 ? (i % 20 == 0 ? 2 : 1) : 0];
+        snprintf(when, sizeof(when), "2025-%02d-%02d %02d:00:00", 1 + i % 12, 1 + i % 28, i % 24);
+        snprintf(score, sizeof(score), "%d-%d", rand() % 30, rand() % 30);
+        table.append(i + 1, stage, 1 + i % 50, 1 + i % 3, p1, p2, when, "completed", p1, score);
+        row_store[i] = Task4_MatchResult(i + 1, stage, 1 + i % 50, 1 + i % 3, p1, p2, when, "completed", p1, score);
+    }
+    std::cout << "Loaded " << rows << " rows in " << elapsedMs(t) << " ms\n";
+
+    long long checksum = 0;
+    t = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) checksum += table.countForPlayer(1 + q);
+    double posting_player = elapsedMs(t) / queries;
+
+    t = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) {
+        int pid = 1 + q, hits = 0;
+        for (int i = 0; i < rows; i++) hits += (row_store[i].player1_id == pid) | (row_store[i].player2_id == pid);
+        checksum -= hits;
+    }
+    double row_player = elapsedMs(t) / queries;
+
+    Task4_Bitmap rows_out;
+    Task4_MatchFilter by_stage;
+    t = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) {
+        by_stage.stage = stages[q % 3];
+        checksum += table.select(by_stage, rows_out);
+    }
+    double bitmap_stage = elapsedMs(t) / queries;
+
+    t = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) {
+        int hits = 0;
+        for (int i = 0; i < rows; i++) hits += (row_store[i].stage == stages[q % 3]);
+        checksum -= hits;
+    }
+    double row_stage = elapsedMs(t) / queries;
+
+    // "knockout AND round 2 AND date in May"
+    Task4_MatchFilter compound;
+    compound.stage = "knockout";
+    compound.round = 2;
+    compound.date_from = "2025-05-01";
+    compound.date_to = "2025-05-31";
+    t = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) checksum += table.select(compound, rows_out);
+    double bitmap_compound = elapsedMs(t) / queries;
+
+    t = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) {
+        int hits = 0;
+        for (int i = 0; i < rows; i++) {
+            const Task4_MatchResult& m = row_store[i];
+            hits += m.stage == "knockout" && m.round == 2 && m.scheduled_time.compare(0, 7, "2025-05") == 0;
+        }
+        checksum -= hits;
+    }
+    double row_compound = elapsedMs(t) / queries;
+
+    // Re-aggregate per-player totals from the integer columns
+    Task4_PlayerTotals* totals = new Task4_PlayerTotals[table.playerCount()];
+    t = std::chrono::steady_clock::now();
+    table.aggregatePlayerTotals(totals);
+    double aggregate_ms = elapsedMs(t);
+    long long wins_total = 0;
+    for (int i = 0; i < table.playerCount(); i++) wins_total += totals[i].wins;
+    checksum += wins_total - rows; // every synthetic match is completed and has one winner
+    delete[] totals;
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Query by player: postings " << posting_player << " ms, rows " << row_player << " ms\n"
+              << "Query by stage:  bitmaps " << bitmap_stage << " ms, rows " << row_stage << " ms\n"
+              << "Compound filter: bitmaps " << bitmap_compound << " ms, rows " << row_compound << " ms\n"
+              << "Re-aggregate player totals: " << aggregate_ms << " ms\n"
+              << "Checksum (0 when both layouts agree): " << checksum << "\n";
+    delete[] row_store;
+    return checksum == 0 ? 0 : 1;
+}
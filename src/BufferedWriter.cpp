@@ -0,0 +1,191 @@
+// BufferedWriter.cpp
+// Shared buffered file output used by the Task 1, 2 and 4 save and export paths.
+
+#include "../EsportsChampionship.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static bool syncFile(FILE* file) {
+    if (fflush(file) != 0) return false;
+#if defined(_WIN32)
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+// rename() is atomic on POSIX; the directory is synced so the new name survives a crash too.
+static bool replaceFile(const char* from, const char* to) {
+#if defined(_WIN32)
+    return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    if (rename(from, to) != 0) return false;
+    std::string dir(to);
+    size_t slash = dir.find_last_of('/');
+    dir = slash == std::string::npos ? std::string(".") : dir.substr(0, slash ? slash : 1);
+    int fd = ::open(dir.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        ::close(fd);
+    }
+    return true;
+#endif
+}
+
+// Shared BufferedWriter implementation
+BufferedWriter::BufferedWriter(size_t buffer_bytes)
+    : file(nullptr), capacity(buffer_bytes < 4096 ? 4096 : buffer_bytes), used(0), flushed(0), failed(false) {
+    buffer = new char[capacity];
+}
+
+BufferedWriter::~BufferedWriter() {
+    close();
+    delete[] buffer;
+}
+
+bool BufferedWriter::open(const char* path, bool append) {
+    close();
+    file = fopen(path, append ? "ab" : "wb");
+    if (!file) return false;
+    setvbuf(file, nullptr, _IONBF, 0); // Our buffer is the only one; each flush is one write
+    used = 0;
+    flushed = 0;
+    failed = false;
+    return true;
+}
+
+bool BufferedWriter::openReplace(const char* path) {
+    std::string temp = std::string(path) + ".tmp";
+    if (!open(temp.c_str())) return false;
+    replaceTarget = path;
+    return true;
+}
+
+bool BufferedWriter::close() {
+    if (!file) return !failed;
+    flush();
+    if (!replaceTarget.empty() && !syncFile(file)) failed = true;
+    if (fclose(file) != 0) failed = true;
+    file = nullptr;
+    if (!replaceTarget.empty()) {
+        std::string temp = replaceTarget + ".tmp";
+        if (failed || !replaceFile(temp.c_str(), replaceTarget.c_str())) {
+            remove(temp.c_str());
+            failed = true;
+        }
+        replaceTarget.clear();
+    }
+    return !failed;
+}
+
+bool BufferedWriter::sync() {
+    if (!file) return false;
+    flush();
+    if (!syncFile(file)) failed = true;
+    return !failed;
+}
+
+bool BufferedWriter::isOpen() const { return file != nullptr; }
+
+bool BufferedWriter::flush() {
+    if (file && used > 0) {
+        if (fwrite(buffer, 1, used, file) != used) failed = true;
+        flushed += (long long)used;
+        APUEC_COUNT_BYTES_WRITTEN(used);
+    }
+    used = 0;
+    return !failed;
+}
+
+long long BufferedWriter::bytesWritten() const { return flushed + (long long)used; }
+
+void BufferedWriter::reserve(size_t n) {
+    if (used + n > capacity) flush();
+}
+
+void BufferedWriter::put(char c) {
+    if (used == capacity) flush();
+    buffer[used++] = c;
+}
+
+void BufferedWriter::write(const void* data, size_t n) {
+    if (n > capacity / 2) { // Large blocks (binary columns) go straight out after what is buffered
+        flush();
+        if (!file) return;
+        if (fwrite(data, 1, n, file) != n) failed = true;
+        flushed += (long long)n;
+        APUEC_COUNT_BYTES_WRITTEN(n);
+        return;
+    }
+    reserve(n);
+    memcpy(buffer + used, data, n);
+    used += n;
+}
+
+void BufferedWriter::write(const char* s) { write(s, strlen(s)); }
+void BufferedWriter::write(const std::string& s) { write(s.data(), s.size()); }
+
+void BufferedWriter::writeInt(long long value) {
+    reserve(24);
+    std::to_chars_result r = std::to_chars(buffer + used, buffer + capacity, value);
+    used = (size_t)(r.ptr - buffer);
+}
+
+// Fixed-point through integers, so no locale or floating-point to_chars support is needed.
+void BufferedWriter::writeFixed(double value, int decimals) {
+    if (decimals < 0) decimals = 0;
+    if (decimals > 6) decimals = 6;
+    long long scale = 1;
+    for (int i = 0; i < decimals; i++) scale *= 10;
+    if (!(value == value) || value > 9.0e18 / scale || value < -9.0e18 / scale) value = 0; // NaN, infinities, out of range
+    bool negative = value < 0;
+    long long scaled = (long long)((negative ? -value : value) * scale + 0.5);
+    if (negative && scaled != 0) put('-');
+    writeInt(scaled / scale);
+    if (decimals == 0) return;
+    put('.');
+    long long frac = scaled % scale;
+    for (long long div = scale / 10; div > 0; div /= 10) put((char)('0' + frac / div % 10));
+}
+
+void BufferedWriter::writeCsvField(const char* s) {
+    if (!s) return;
+    for (; *s; s++) {
+        if (*s >= 32 && *s <= 126) put(*s == ',' ? ';' : *s);
+    }
+}
+
+void BufferedWriter::writeCsvQuoted(const char* s) {
+    if (!s) return;
+    if (!strpbrk(s, ",\"\r\n")) { write(s); return; }
+    put('"');
+    for (; *s; s++) {
+        if (*s == '"') put('"');
+        put(*s);
+    }
+    put('"');
+}
+
+void BufferedWriter::writeJsonString(const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    put('"');
+    for (; s && *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') { put('\\'); put((char)c); }
+        else if (c == '\n') { put('\\'); put('n'); }
+        else if (c == '\r') { put('\\'); put('r'); }
+        else if (c == '\t') { put('\\'); put('t'); }
+        else if (c < 0x20) { write("\\u00", 4); put(hex[c >> 4]); put(hex[c & 15]); }
+        else put((char)c);
+    }
+    put('"');
+}
@@ -0,0 +1,224 @@
+// Instrumentation.cpp
+// Latency histograms, the operation registry and the allocation / write counters
+// behind the APUEC_SCOPED_TIMER and APUEC_COUNT_BYTES_WRITTEN macros.
+
+#include "../EsportsChampionship.hpp"
+#include <mutex>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Bucket index of the highest set bit (value > 0).
+static inline int instrument_highestBit(uint64_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return (int)index;
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+// LatencyHistogram implementations
+LatencyHistogram::LatencyHistogram() { reset(); }
+
+void LatencyHistogram::reset() {
+    for (int i = 0; i < BUCKETS; i++) counts[i].store(0, std::memory_order_relaxed);
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    lowest.store(UINT64_MAX, std::memory_order_relaxed);
+    highest.store(0, std::memory_order_relaxed);
+}
+
+// Below 2 * SUB_BUCKETS the value is its own bucket. Above, the top six bits pick one of
+// SUB_BUCKETS buckets within the value's power of two.
+int LatencyHistogram::bucketOf(uint64_t value) {
+    if (value < 2 * SUB_BUCKETS) return (int)value;
+    int shift = instrument_highestBit(value) - 5; // keeps the value's top six bits
+    return 2 * SUB_BUCKETS + (shift - 1) * SUB_BUCKETS + (int)((value >> shift) - SUB_BUCKETS);
+}
+
+uint64_t LatencyHistogram::bucketHighest(int bucket) {
+    if (bucket < 2 * SUB_BUCKETS) return (uint64_t)bucket;
+    int shift = (bucket - 2 * SUB_BUCKETS) / SUB_BUCKETS + 1;
+    uint64_t top = (uint64_t)((bucket - 2 * SUB_BUCKETS) % SUB_BUCKETS + SUB_BUCKETS);
+    return ((top + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds) {
+    counts[bucketOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+    uint64_t seen = lowest.load(std::memory_order_relaxed);
+    while (nanoseconds < seen && !lowest.compare_exchange_weak(seen, nanoseconds, std::memory_order_relaxed)) {}
+    seen = highest.load(std::memory_order_relaxed);
+    while (nanoseconds > seen && !highest.compare_exchange_weak(seen, nanoseconds, std::memory_order_relaxed)) {}
+}
+
+uint64_t LatencyHistogram::count() const { return total.load(std::memory_order_relaxed); }
+uint64_t LatencyHistogram::min() const { return count() ? lowest.load(std::memory_order_relaxed) : 0; }
+uint64_t LatencyHistogram::max() const { return highest.load(std::memory_order_relaxed); }
+
+double LatencyHistogram::mean() const {
+    uint64_t n = count();
+    return n ? (double)sum.load(std::memory_order_relaxed) / (double)n : 0.0;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    uint64_t n = count();
+    if (n == 0) return 0;
+    uint64_t rank = (uint64_t)(p / 100.0 * (double)n + 0.5); // the rank-th smallest value, 1-based
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    uint64_t seen = 0;
+    for (int b = 0; b < BUCKETS; b++) {
+        seen += counts[b].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            uint64_t value = bucketHighest(b);
+            return value < max() ? value : max();
+        }
+    }
+    return max();
+}
+
+// ScopedTimer implementations
+ScopedTimer::ScopedTimer(LatencyHistogram* h) : histogram(h), start(std::chrono::steady_clock::now()) {}
+
+ScopedTimer::~ScopedTimer() {
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+    histogram->record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+// Instrumentation implementations
+// The counters are constant-initialised, so operator new can update them before any
+// other static constructor has run.
+static std::atomic<uint64_t> instrument_allocations(0);
+static std::atomic<uint64_t> instrument_allocated_bytes(0);
+static std::atomic<uint64_t> instrument_frees(0);
+static std::atomic<uint64_t> instrument_bytes_written(0);
+
+struct InstrumentOperation {
+    const char* name;
+    LatencyHistogram histogram;
+};
+
+static InstrumentOperation instrument_operations[Instrumentation::MAX_OPERATIONS];
+static int instrument_operation_count = 0;
+static std::mutex instrument_registry_mutex;
+
+LatencyHistogram* Instrumentation::histogram(const char* operation) {
+    std::lock_guard<std::mutex> lock(instrument_registry_mutex);
+    for (int i = 0; i < instrument_operation_count; i++) {
+        if (strcmp(instrument_operations[i].name, operation) == 0) return &instrument_operations[i].histogram;
+    }
+    if (instrument_operation_count == MAX_OPERATIONS) { // Shares the last slot rather than failing a hot path
+        std::cerr << "Instrumentation: more than " << MAX_OPERATIONS << " operations; '" << operation
+                  << "' is folded into '" << instrument_operations[MAX_OPERATIONS - 1].name << "'." << std::endl;
+        return &instrument_operations[MAX_OPERATIONS - 1].histogram;
+    }
+    instrument_operations[instrument_operation_count].name = operation;
+    return &instrument_operations[instrument_operation_count++].histogram;
+}
+
+void Instrumentation::countAllocation(size_t bytes) {
+    instrument_allocations.fetch_add(1, std::memory_order_relaxed);
+    instrument_allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void Instrumentation::countFree() { instrument_frees.fetch_add(1, std::memory_order_relaxed); }
+
+void Instrumentation::addBytesWritten(long long bytes) {
+    instrument_bytes_written.fetch_add((uint64_t)bytes, std::memory_order_relaxed);
+}
+
+void Instrumentation::reset() {
+    std::lock_guard<std::mutex> lock(instrument_registry_mutex);
+    for (int i = 0; i < instrument_operation_count; i++) instrument_operations[i].histogram.reset();
+    instrument_allocations.store(0, std::memory_order_relaxed);
+    instrument_allocated_bytes.store(0, std::memory_order_relaxed);
+    instrument_frees.store(0, std::memory_order_relaxed);
+    instrument_bytes_written.store(0, std::memory_order_relaxed);
+}
+
+void Instrumentation::printReport(std::ostream& out) {
+#if !APUEC_INSTRUMENT
+    out << "\nInstrumentation is compiled out of this build (configure with -DAPUEC_INSTRUMENT=ON).\n";
+    return;
+#endif
+    std::lock_guard<std::mutex> lock(instrument_registry_mutex);
+    out << "\n=========================== INSTRUMENTATION ===========================\n"
+        << std::left << std::setw(34) << "Operation" << std::right << std::setw(8) << "Count"
+        << std::setw(11) << "p50 (us)" << std::setw(11) << "p99 (us)" << std::setw(11) << "p999 (us)"
+        << std::setw(11) << "max (us)" << "\n"
+        << "-----------------------------------------------------------------------\n";
+    out << std::fixed << std::setprecision(1);
+    for (int i = 0; i < instrument_operation_count; i++) {
+        const LatencyHistogram& h = instrument_operations[i].histogram;
+        out << std::left << std::setw(34) << instrument_operations[i].name << std::right << std::setw(8) << h.count()
+            << std::setw(11) << h.percentile(50) / 1000.0 << std::setw(11) << h.percentile(99) / 1000.0
+            << std::setw(11) << h.percentile(99.9) / 1000.0 << std::setw(11) << h.max() / 1000.0 << "\n";
+    }
+    if (instrument_operation_count == 0) out << "(no instrumented operation has run yet)\n";
+    out.unsetf(std::ios::floatfield);
+    out << "-----------------------------------------------------------------------\n"
+        << "Allocations: " << instrument_allocations.load() << " (" << instrument_allocated_bytes.load()
+        << " bytes requested), frees: " << instrument_frees.load() << "\n"
+        << "Bytes written to files: " << instrument_bytes_written.load() << "\n";
+}
+
+bool Instrumentation::writeJSON(const char* path) {
+#if !APUEC_INSTRUMENT
+    (void)path;
+    return false;
+#endif
+    BufferedWriter out(64 * 1024);
+    if (!out.open(path)) return false;
+    std::lock_guard<std::mutex> lock(instrument_registry_mutex);
+    out.write("{\n  \"counters\": {\n    \"allocations\": "); out.writeInt((long long)instrument_allocations.load());
+    out.write(",\n    \"allocated_bytes\": "); out.writeInt((long long)instrument_allocated_bytes.load());
+    out.write(",\n    \"frees\": "); out.writeInt((long long)instrument_frees.load());
+    out.write(",\n    \"bytes_written\": "); out.writeInt((long long)instrument_bytes_written.load());
+    out.write("\n  },\n  \"operations\": [");
+    for (int i = 0; i < instrument_operation_count; i++) {
+        const LatencyHistogram& h = instrument_operations[i].histogram;
+        out.write(i ? ",\n    {\"name\": " : "\n    {\"name\": "); out.writeJsonString(instrument_operations[i].name);
+        out.write(", \"count\": "); out.writeInt((long long)h.count());
+        out.write(", \"min_ns\": "); out.writeInt((long long)h.min());
+        out.write(", \"mean_ns\": "); out.writeFixed(h.mean(), 1);
+        out.write(", \"p50_ns\": "); out.writeInt((long long)h.percentile(50));
+        out.write(", \"p99_ns\": "); out.writeInt((long long)h.percentile(99));
+        out.write(", \"p999_ns\": "); out.writeInt((long long)h.percentile(99.9));
+        out.write(", \"max_ns\": "); out.writeInt((long long)h.max());
+        out.put('}');
+    }
+    out.write("\n  ]\n}\n");
+    return out.close();
+}
+
+#if APUEC_INSTRUMENT
+// Global allocation counting. Every new/delete in the program funnels through these,
+// so the counters cover all four tasks; malloc/free (Task 2) are not seen here.
+void* operator new(size_t size) {
+    Instrumentation::countAllocation(size);
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    Instrumentation::countAllocation(size);
+    return malloc(size ? size : 1);
+}
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    Instrumentation::countFree();
+    free(p);
+}
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { operator delete(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { operator delete(p); }
+#endif
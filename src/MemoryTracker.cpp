@@ -0,0 +1,134 @@
+// MemoryTracker.cpp
+// Per-subsystem live/peak byte counters behind the tagged allocations, plus the
+// process RSS for the memory footprint report.
+
+#include "../EsportsChampionship.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+struct MemoryTagCounters {
+    std::atomic<long long> live_bytes;
+    std::atomic<long long> live_blocks;
+    std::atomic<long long> peak_bytes;
+    std::atomic<long long> allocations;
+};
+
+// Zero-initialised before any constructor runs, so static objects may allocate too.
+static MemoryTagCounters memory_counters[MEMORY_TAG_COUNT];
+
+static const char* const memory_tag_names[MEMORY_TAG_COUNT] = {
+    "Task 1 players", "Task 1 matches", "Task 2 registrations", "Task 3 queues", "Task 4 history"};
+
+// MemoryTracker implementations
+void* MemoryTracker::allocate(size_t bytes, MemoryTag tag) {
+    void* block = malloc(bytes > 0 ? bytes : 1);
+    if (!block) return nullptr;
+    MemoryTagCounters& c = memory_counters[tag];
+    long long live = c.live_bytes.fetch_add((long long)bytes, std::memory_order_relaxed) + (long long)bytes;
+    c.live_blocks.fetch_add(1, std::memory_order_relaxed);
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    long long peak = c.peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !c.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+    return block;
+}
+
+void MemoryTracker::release(void* block, size_t bytes, MemoryTag tag) {
+    if (!block) return;
+    MemoryTagCounters& c = memory_counters[tag];
+    c.live_bytes.fetch_sub((long long)bytes, std::memory_order_relaxed);
+    c.live_blocks.fetch_sub(1, std::memory_order_relaxed);
+    free(block);
+}
+
+long long MemoryTracker::liveBytes(MemoryTag tag) { return memory_counters[tag].live_bytes.load(std::memory_order_relaxed); }
+long long MemoryTracker::liveBlocks(MemoryTag tag) { return memory_counters[tag].live_blocks.load(std::memory_order_relaxed); }
+long long MemoryTracker::peakBytes(MemoryTag tag) { return memory_counters[tag].peak_bytes.load(std::memory_order_relaxed); }
+long long MemoryTracker::totalAllocations(MemoryTag tag) { return memory_counters[tag].allocations.load(std::memory_order_relaxed); }
+
+const char* MemoryTracker::tagName(MemoryTag tag) {
+    return tag >= 0 && tag < MEMORY_TAG_COUNT ? memory_tag_names[tag] : "unknown";
+}
+
+long long MemoryTracker::currentRSS() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS info;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info))) return (long long)info.WorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (!statm) return 0;
+    long long pages_total = 0, pages_resident = 0;
+    int fields = fscanf(statm, "%lld %lld", &pages_total, &pages_resident);
+    fclose(statm);
+    return fields == 2 ? pages_resident * (long long)sysconf(_SC_PAGESIZE) : 0;
+#else
+    return 0;
+#endif
+}
+
+long long MemoryTracker::peakRSS() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS info;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info))) return (long long)info.PeakWorkingSetSize;
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return (long long)usage.ru_maxrss; // bytes on macOS
+#else
+    return (long long)usage.ru_maxrss * 1024; // kilobytes elsewhere
+#endif
+#endif
+}
+
+void MemoryTracker::printReport(std::ostream& out) {
+    long long total_live = 0, total_blocks = 0;
+    out << "\n======================== MEMORY FOOTPRINT =========================\n"
+        << std::left << std::setw(24) << "Subsystem" << std::right << std::setw(11) << "Live (KB)"
+        << std::setw(9) << "Blocks" << std::setw(11) << "Peak (KB)" << std::setw(12) << "Allocations" << "\n"
+        << "-------------------------------------------------------------------\n";
+    out << std::fixed << std::setprecision(1);
+    for (int t = 0; t < MEMORY_TAG_COUNT; t++) {
+        MemoryTag tag = (MemoryTag)t;
+        total_live += liveBytes(tag);
+        total_blocks += liveBlocks(tag);
+        out << std::left << std::setw(24) << tagName(tag) << std::right << std::setw(11) << liveBytes(tag) / 1024.0
+            << std::setw(9) << liveBlocks(tag) << std::setw(11) << peakBytes(tag) / 1024.0
+            << std::setw(12) << totalAllocations(tag) << "\n";
+    }
+    out << "-------------------------------------------------------------------\n"
+        << std::left << std::setw(24) << "Tracked total" << std::right << std::setw(11) << total_live / 1024.0
+        << std::setw(9) << total_blocks << "\n"
+        << "Process RSS: " << currentRSS() / (1024.0 * 1024.0) << " MB (peak " << peakRSS() / (1024.0 * 1024.0) << " MB)\n";
+    out.unsetf(std::ios::floatfield);
+}
+
+// By the time atexit handlers run, main()'s managers have been destroyed, so anything
+// still live in a subsystem was never released.
+static void memory_reportLeaks() {
+    long long leaked = 0;
+    for (int t = 0; t < MEMORY_TAG_COUNT; t++) leaked += MemoryTracker::liveBytes((MemoryTag)t);
+    if (leaked == 0) return;
+    fprintf(stderr, "Memory check: %lld bytes still allocated at exit:\n", leaked);
+    for (int t = 0; t < MEMORY_TAG_COUNT; t++) {
+        MemoryTag tag = (MemoryTag)t;
+        if (MemoryTracker::liveBytes(tag) == 0) continue;
+        fprintf(stderr, "  %-22s %lld bytes in %lld blocks\n", MemoryTracker::tagName(tag),
+                MemoryTracker::liveBytes(tag), MemoryTracker::liveBlocks(tag));
+    }
+}
+
+void MemoryTracker::reportLeaksAtExit() {
+    static bool registered = false;
+    if (!registered) registered = atexit(memory_reportLeaks) == 0;
+}
@@ -0,0 +1,662 @@
+// ServiceMode.cpp
+// Service mode: one epoll event loop serving a small HTTP/JSON API over the same
+// Tournament, Task 2 registry and Task 4 manager the menus use, so several check-in
+// desks can work at once. Requests are handled one at a time on the loop thread,
+// so the modules need no locking.
+
+#include "../EsportsChampionship.hpp"
+
+ServiceOptions::ServiceOptions() : port(8080), bind_address("127.0.0.1"), max_connections(1024) {}
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <csignal>
+#include <cerrno>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static const char* const SERVICE_REGISTRATION_CSV = "Player_Registration.csv";
+static const size_t SERVICE_MAX_REQUEST = 64 * 1024; // Header and body together
+static const int SERVICE_EVENTS_PER_WAIT = 256;
+
+static volatile sig_atomic_t service_stop_requested = 0;
+static void service_onSignal(int) { service_stop_requested = 1; }
+
+// One client connection. Pipelined requests are answered in order.
+struct ServiceConnection {
+    int fd;
+    std::string in;
+    std::string out;
+    size_t out_sent;
+    bool close_after_write; // Connection: close, a malformed request, or the peer hung up
+    bool want_write;        // EPOLLOUT registered while a response is only partly sent
+    ServiceConnection* prev;
+    ServiceConnection* next;
+};
+
+struct ServiceRequest {
+    std::string method;
+    std::string path;
+    std::string query; // after '?', without it
+    std::string body;
+    bool keep_alive;
+};
+
+struct ServiceResponse {
+    int status;
+    std::string body; // JSON
+};
+
+// The modules behind the API.
+struct ServiceState {
+    Tournament* tournament;
+    Task4_GameResultManager* results;
+    struct Task2_PriorityQueue registry;
+    int next_player_id;
+    bool registry_dirty; // Saved once per loop pass rather than once per request
+    long long requests;
+};
+
+// --- Parsing ---
+
+static bool service_equalsIgnoreCase(const char* a, const char* b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (tolower((unsigned char)a[i]) != tolower((unsigned char)b[i])) return false;
+    }
+    return true;
+}
+
+// Parses the request at the front of `in`. Returns the bytes it used, 0 while it is still
+// incomplete, or -1 when it is malformed or larger than SERVICE_MAX_REQUEST.
+static long service_parseRequest(const std::string& in, ServiceRequest& req) {
+    size_t header_end = in.find("\r\n\r\n");
+    if (header_end == std::string::npos) return in.size() > SERVICE_MAX_REQUEST ? -1 : 0;
+
+    size_t line_end = in.find("\r\n");
+    size_t sp1 = in.find(' ');
+    size_t sp2 = sp1 == std::string::npos ? sp1 : in.find(' ', sp1 + 1);
+    if (sp1 == std::string::npos || sp2 == std::string::npos || sp2 > line_end) return -1;
+    req.method = in.substr(0, sp1);
+    std::string target = in.substr(sp1 + 1, sp2 - sp1 - 1);
+    size_t question = target.find('?');
+    req.path = target.substr(0, question);
+    req.query = question == std::string::npos ? "" : target.substr(question + 1);
+    req.keep_alive = in.compare(sp2 + 1, 8, "HTTP/1.1") == 0; // HTTP/1.0 closes unless asked
+
+    long long content_length = 0;
+    for (size_t pos = line_end + 2; pos < header_end; ) {
+        size_t eol = in.find("\r\n", pos);
+        const char* line = in.c_str() + pos;
+        size_t len = eol - pos;
+        if (len > 15 && service_equalsIgnoreCase(line, "content-length:", 15)) {
+            content_length = atoll(line + 15);
+            if (content_length < 0) return -1;
+        } else if (len > 11 && service_equalsIgnoreCase(line, "connection:", 11)) {
+            const char* value = line + 11;
+            while (*value == ' ') value++;
+            if (service_equalsIgnoreCase(value, "close", 5)) req.keep_alive = false;
+            else if (service_equalsIgnoreCase(value, "keep-alive", 10)) req.keep_alive = true;
+        }
+        pos = eol + 2;
+    }
+    size_t total = header_end + 4 + (size_t)content_length;
+    if (total > SERVICE_MAX_REQUEST) return -1;
+    if (in.size() < total) return 0;
+    req.body = in.substr(header_end + 4, (size_t)content_length);
+    return (long)total;
+}
+
+static void service_skipSpace(const std::string& body, size_t& pos) {
+    while (pos < body.size() && isspace((unsigned char)body[pos])) pos++;
+}
+
+// A JSON string starting at its opening quote, unescaped into `out`; pos ends past the closing quote.
+static bool service_jsonString(const std::string& body, size_t& pos, std::string& out) {
+    out.clear();
+    for (pos++; pos < body.size() && body[pos] != '"'; pos++) {
+        if (body[pos] == '\\' && pos + 1 < body.size()) pos++;
+        out += body[pos];
+    }
+    if (pos >= body.size()) return false;
+    pos++;
+    return true;
+}
+
+// Value of a top-level "key" in a JSON object: a string (unescaped) or a bare number/literal.
+// Members are walked in order and nested objects or arrays skipped, so text inside a string
+// value or a nested member never matches the key.
+static bool service_jsonValue(const std::string& body, const char* key, std::string& out) {
+    size_t pos = 0;
+    service_skipSpace(body, pos);
+    if (pos >= body.size() || body[pos] != '{') return false;
+    pos++;
+    std::string name, value;
+    while (true) {
+        service_skipSpace(body, pos);
+        if (pos >= body.size() || body[pos] != '"' || !service_jsonString(body, pos, name)) return false;
+        service_skipSpace(body, pos);
+        if (pos >= body.size() || body[pos] != ':') return false;
+        pos++;
+        service_skipSpace(body, pos);
+        if (pos >= body.size()) return false;
+        bool quoted = body[pos] == '"', nested = body[pos] == '{' || body[pos] == '[';
+        if (quoted) {
+            if (!service_jsonString(body, pos, value)) return false;
+        } else if (nested) {
+            int depth = 0;
+            do {
+                if (body[pos] == '"') { if (!service_jsonString(body, pos, value)) return false; continue; }
+                if (body[pos] == '{' || body[pos] == '[') depth++;
+                else if (body[pos] == '}' || body[pos] == ']') depth--;
+                pos++;
+            } while (depth > 0 && pos < body.size());
+            if (depth > 0) return false;
+        } else {
+            value.clear();
+            while (pos < body.size() && body[pos] != ',' && body[pos] != '}' && !isspace((unsigned char)body[pos])) value += body[pos++];
+        }
+        if (name == key) {
+            if (nested || (!quoted && value.empty())) return false;
+            out = value;
+            return true;
+        }
+        service_skipSpace(body, pos);
+        if (pos >= body.size() || body[pos] != ',') return false; // '}' ends the object
+        pos++;
+    }
+}
+
+// Value of name=value in a query string (no percent-decoding; the API only takes IDs there).
+static bool service_queryValue(const std::string& query, const char* name, std::string& out) {
+    size_t name_len = strlen(name);
+    for (size_t pos = 0; pos < query.size(); ) {
+        size_t amp = query.find('&', pos);
+        if (amp == std::string::npos) amp = query.size();
+        if (amp - pos > name_len && query.compare(pos, name_len, name) == 0 && query[pos + name_len] == '=') {
+            out = query.substr(pos + name_len + 1, amp - pos - name_len - 1);
+            return true;
+        }
+        pos = amp + 1;
+    }
+    return false;
+}
+
+static bool service_parseInt(const std::string& text, int& value) {
+    if (text.empty()) return false;
+    char* end = nullptr;
+    long parsed = strtol(text.c_str(), &end, 10);
+    if (*end != '\0') return false;
+    value = (int)parsed;
+    return true;
+}
+
+// --- Responses ---
+
+static void service_appendJsonString(std::string& out, const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    out += '"';
+    for (; s && *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') { out += '\\'; out += (char)c; }
+        else if (c < 0x20) { out += "\\u00"; out += hex[c >> 4]; out += hex[c & 15]; }
+        else out += (char)c;
+    }
+    out += '"';
+}
+
+static void service_error(ServiceResponse& res, int status, const char* message) {
+    res.status = status;
+    res.body = "{\"error\":";
+    service_appendJsonString(res.body, message);
+    res.body += "}";
+}
+
+static const char* service_statusText(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 201: return "Created";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 409: return "Conflict";
+        case 413: return "Payload Too Large";
+        default: return "Internal Server Error";
+    }
+}
+
+static void service_appendResponse(std::string& out, const ServiceResponse& res, bool keep_alive) {
+    char header[192];
+    int n = snprintf(header, sizeof(header),
+                     "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %zu\r\nConnection: %s\r\n\r\n",
+                     res.status, service_statusText(res.status), res.body.size() + 1, keep_alive ? "keep-alive" : "close");
+    out.append(header, (size_t)n);
+    out += res.body;
+    out += '\n';
+}
+
+// --- Handlers ---
+
+// Mirrors a Task 2 registration, and its check-in if it has one, into the Tournament, which
+// groups only the players it knows as checked in. Known players and check-ins are left alone.
+static void service_syncPlayer(ServiceState& state, const struct Task2_Player* player) {
+    int id = atoi(player->playerID);
+    state.tournament->addPlayer(id, player->playerName, player->rank, player->registrationType);
+    if (player->checkInStatus) state.tournament->checkInPlayer(id, player->checkInTime);
+}
+
+// POST /register {"name": "...", "type": "Early-Bird", "email": "..."}
+static void service_register(ServiceState& state, const ServiceRequest& req, ServiceResponse& res) {
+    std::string name, type, email;
+    if (!service_jsonValue(req.body, "name", name) || name.empty()) { service_error(res, 400, "name is required"); return; }
+    if (!service_jsonValue(req.body, "type", type)) type = "Standard";
+    if (!service_jsonValue(req.body, "email", email) || email.empty()) email = "N/A"; // The CSV reader skips empty fields
+
+    struct Task2_Player* player = Task2_addPlayer(&state.registry, state.next_player_id, name.c_str(), type.c_str(), email.c_str());
+    if (!player) { service_error(res, 500, "out of memory"); return; }
+    state.next_player_id++;
+    state.registry_dirty = true;
+    service_syncPlayer(state, player);
+
+    res.status = 201;
+    res.body = "{\"player_id\":";
+    service_appendJsonString(res.body, player->playerID);
+    res.body += ",\"name\":"; service_appendJsonString(res.body, player->playerName);
+    res.body += ",\"registration_type\":"; service_appendJsonString(res.body, player->registrationType);
+    res.body += ",\"rank\":"; service_appendJsonString(res.body, player->rank);
+    res.body += ",\"status\":"; service_appendJsonString(res.body, player->status);
+    res.body += "}";
+}
+
+// POST /checkin {"player_id": "1001"}
+// Applied synchronously so the reply carries the outcome; the registry is shared with /register and
+// /withdraw, which Task2_CheckInPipeline's applier would own (the Task 2 desk runs on it instead).
+static void service_checkIn(ServiceState& state, const ServiceRequest& req, ServiceResponse& res) {
+    std::string id;
+    if (!service_jsonValue(req.body, "player_id", id) || id.empty()) { service_error(res, 400, "player_id is required"); return; }
+    struct Task2_Player* player = Task2_checkInByID(&state.registry, id.c_str());
+    if (!player) { service_error(res, 404, "player not registered"); return; }
+    state.registry_dirty = true;
+    service_syncPlayer(state, player);
+
+    res.status = 200;
+    res.body = "{\"player_id\":";
+    service_appendJsonString(res.body, player->playerID);
+    res.body += ",\"name\":"; service_appendJsonString(res.body, player->playerName);
+    res.body += ",\"status\":"; service_appendJsonString(res.body, player->status);
+    res.body += ",\"checked_in\":true,\"check_in_time\":"; service_appendJsonString(res.body, player->checkInTime);
+    res.body += "}";
+}
+
+// POST /withdraw {"player_id": "1001"}
+static void service_withdraw(ServiceState& state, const ServiceRequest& req, ServiceResponse& res) {
+    std::string id;
+    if (!service_jsonValue(req.body, "player_id", id) || id.empty()) { service_error(res, 400, "player_id is required"); return; }
+    // The tournament first: once matches are scheduled the withdrawal is refused before the registry changes.
+    int player_id;
+    const char* error = nullptr;
+    if (service_parseInt(id, player_id) && !state.tournament->withdrawPlayer(player_id, &error) && strcmp(error, "unknown player") != 0) {
+        service_error(res, 409, error);
+        return;
+    }
+    struct Task2_WithdrawResult result = Task2_withdrawPlayer(&state.registry, id.c_str());
+    if (!result.found) { service_error(res, 404, "player not registered"); return; }
+    state.registry_dirty = true;
+    if (result.promoted) service_syncPlayer(state, result.promoted);
+
+    res.status = 200;
+    res.body = "{\"player_id\":";
+    service_appendJsonString(res.body, id.c_str());
+    res.body += ",\"withdrawn_from\":";
+    service_appendJsonString(res.body, result.fromWaitlist ? "WAITLIST" : "MAIN");
+    res.body += ",\"promoted\":";
+    if (result.promoted) service_appendJsonString(res.body, result.promoted->playerID);
+    else res.body += "null";
+    res.body += "}";
+}
+
+// POST /result {"match_id": 3, "winner_id": 1004}
+static void service_result(ServiceState& state, const ServiceRequest& req, ServiceResponse& res) {
+    std::string text;
+    int match_id, winner_id;
+    if (!service_jsonValue(req.body, "match_id", text) || !service_parseInt(text, match_id)) { service_error(res, 400, "match_id is required"); return; }
+    if (!service_jsonValue(req.body, "winner_id", text) || !service_parseInt(text, winner_id)) { service_error(res, 400, "winner_id is required"); return; }
+
+    Match* match = state.tournament->findMatch(match_id);
+    if (!match) { service_error(res, 404, "unknown match"); return; }
+    if (strcmp(match->getStatus(), "completed") == 0) { service_error(res, 409, "match already completed"); return; }
+    const char* error = nullptr;
+    if (!state.tournament->submitResult(match_id, winner_id, &error)) { service_error(res, 400, error); return; }
+
+    res.status = 200;
+    res.body = "{\"match_id\":" + std::to_string(match_id) + ",\"winner_id\":" + std::to_string(winner_id) +
+               ",\"status\":\"completed\",\"matches_total\":" + std::to_string(state.tournament->getMatchCount()) + "}";
+}
+
+static int service_countCheckedIn(struct Task2_Queue* queue) {
+    int count = 0;
+    for (struct Task2_Player* p = queue->front; p; p = p->next) count += p->checkInStatus ? 1 : 0;
+    return count;
+}
+
+// GET /stats (summary) or GET /stats?player_id=1001 (Task 4 history for one player)
+static void service_stats(ServiceState& state, const ServiceRequest& req, ServiceResponse& res) {
+    std::string text;
+    if (service_queryValue(req.query, "player_id", text)) {
+        int player_id;
+        if (!service_parseInt(text, player_id)) { service_error(res, 400, "player_id must be a number"); return; }
+        const Task4_PlayerStats* stats = state.results->getPlayerStats(player_id);
+        if (!stats) { service_error(res, 404, "no result history for player"); return; }
+        char numbers[160];
+        snprintf(numbers, sizeof(numbers), ",\"matches\":%d,\"wins\":%d,\"losses\":%d,\"average_score\":%.2f,\"leaderboard_rank\":%d}",
+                 stats->total_matches, stats->wins, stats->losses, stats->averageScore(), state.results->playerRank(player_id));
+        res.status = 200;
+        res.body = "{\"player_id\":" + std::to_string(player_id) + ",\"name\":";
+        service_appendJsonString(res.body, stats->name.c_str());
+        res.body += ",\"rank\":"; service_appendJsonString(res.body, stats->rank.c_str());
+        res.body += numbers;
+        return;
+    }
+
+    struct Task2_PriorityQueue& r = state.registry;
+    int checked_in = service_countCheckedIn(&r.earlyBirdQueue) + service_countCheckedIn(&r.wildcardQueue) +
+                     service_countCheckedIn(&r.standardQueue) + service_countCheckedIn(&r.lastMinuteQueue) +
+                     service_countCheckedIn(&r.waitlistQueue);
+    TournamentSnapshotRef snapshot(*state.tournament);
+    res.status = 200;
+    res.body = "{\"registered_main\":" + std::to_string(r.getSize()) +
+               ",\"waitlisted\":" + std::to_string(r.getWaitlistQueue()->getSize()) +
+               ",\"checked_in\":" + std::to_string(checked_in) +
+               ",\"matches_total\":" + std::to_string(snapshot->matchCount) +
+               ",\"matches_completed\":" + std::to_string(snapshot->completedMatchCount()) +
+               ",\"matches_upcoming\":" + std::to_string(snapshot->upcomingCount) +
+               ",\"stage\":";
+    service_appendJsonString(res.body, snapshot->stageDescription());
+    res.body += ",\"requests_served\":" + std::to_string(state.requests) + "}";
+}
+
+// POST /schedule: groups every checked-in player, API check-ins included, then creates the
+// group semifinals as the Task 1 menu does
+static void service_schedule(ServiceState& state, ServiceResponse& res) {
+    if (state.tournament->getMatchCount() > 0) { service_error(res, 409, "matches already scheduled"); return; }
+    if (state.tournament->regroup() == 0) { service_error(res, 409, "no group of four could be formed; check more players in first"); return; }
+    state.tournament->createGroupSemifinals();
+    res.status = 201;
+    res.body = "{\"matches_total\":" + std::to_string(state.tournament->getMatchCount()) + "}";
+}
+
+// GET /matches: every match in the current tournament snapshot, so desks can submit results by ID
+static void service_matches(ServiceState& state, ServiceResponse& res) {
+    TournamentSnapshotRef snapshot(*state.tournament);
+    res.status = 200;
+    res.body = "{\"version\":" + std::to_string(snapshot->version) + ",\"matches\":[";
+    for (int i = 0; i < snapshot->matchCount; i++) {
+        const TournamentSnapshotMatch& m = snapshot->matches[i];
+        const TournamentSnapshotPlayer* p1 = snapshot->player(m.player1);
+        const TournamentSnapshotPlayer* p2 = snapshot->player(m.player2);
+        const TournamentSnapshotPlayer* winner = snapshot->player(m.winner);
+        if (i > 0) res.body += ',';
+        res.body += "{\"match_id\":" + std::to_string(m.id) + ",\"stage\":";
+        service_appendJsonString(res.body, m.stage);
+        res.body += ",\"round\":" + std::to_string(m.round);
+        res.body += ",\"player1_id\":" + (p1 ? std::to_string(p1->id) : std::string("null"));
+        res.body += ",\"player2_id\":" + (p2 ? std::to_string(p2->id) : std::string("null"));
+        res.body += ",\"status\":"; service_appendJsonString(res.body, m.status);
+        res.body += ",\"winner_id\":" + (winner ? std::to_string(winner->id) : std::string("null"));
+        res.body += "}";
+    }
+    res.body += "]}";
+}
+
+static void service_handle(ServiceState& state, const ServiceRequest& req, ServiceResponse& res) {
+    APUEC_SCOPED_TIMER("Service request");
+    state.requests++;
+    bool get = req.method == "GET", post = req.method == "POST";
+    if (get) state.tournament->publishPendingChanges(); // Reads see registrations made earlier in this pass
+    if (req.path == "/register") { if (post) service_register(state, req, res); else service_error(res, 405, "use POST"); }
+    else if (req.path == "/checkin") { if (post) service_checkIn(state, req, res); else service_error(res, 405, "use POST"); }
+    else if (req.path == "/withdraw") { if (post) service_withdraw(state, req, res); else service_error(res, 405, "use POST"); }
+    else if (req.path == "/schedule") { if (post) service_schedule(state, res); else service_error(res, 405, "use POST"); }
+    else if (req.path == "/result") { if (post) service_result(state, req, res); else service_error(res, 405, "use POST"); }
+    else if (req.path == "/stats") { if (get) service_stats(state, req, res); else service_error(res, 405, "use GET"); }
+    else if (req.path == "/matches") { if (get) service_matches(state, res); else service_error(res, 405, "use GET"); }
+    else service_error(res, 404, "unknown endpoint");
+}
+
+// --- Event loop ---
+
+static void service_closeConnection(int epoll_fd, ServiceConnection*& list, ServiceConnection* conn) {
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, conn->fd, nullptr);
+    close(conn->fd);
+    if (conn->prev) conn->prev->next = conn->next; else list = conn->next;
+    if (conn->next) conn->next->prev = conn->prev;
+    delete conn;
+}
+
+// Sends what is queued; returns false once the connection should be closed.
+static bool service_flush(int epoll_fd, ServiceConnection* conn) {
+    while (conn->out_sent < conn->out.size()) {
+        ssize_t n = send(conn->fd, conn->out.data() + conn->out_sent, conn->out.size() - conn->out_sent, MSG_NOSIGNAL);
+        if (n > 0) { conn->out_sent += (size_t)n; continue; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if (!conn->want_write) {
+                epoll_event ev;
+                ev.events = EPOLLIN | EPOLLOUT;
+                ev.data.ptr = conn;
+                epoll_ctl(epoll_fd, EPOLL_CTL_MOD, conn->fd, &ev);
+                conn->want_write = true;
+            }
+            return true;
+        }
+        return false;
+    }
+    conn->out.clear();
+    conn->out_sent = 0;
+    if (conn->want_write) {
+        epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = conn;
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, conn->fd, &ev);
+        conn->want_write = false;
+    }
+    return !conn->close_after_write;
+}
+
+// Reads what arrived and answers every complete request; false once the connection is done.
+static bool service_onReadable(ServiceState& state, ServiceConnection* conn) {
+    char buffer[16 * 1024];
+    while (true) {
+        ssize_t n = recv(conn->fd, buffer, sizeof(buffer), 0);
+        if (n > 0) { conn->in.append(buffer, (size_t)n); continue; }
+        if (n == 0) { conn->close_after_write = true; break; } // Peer finished sending
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        return false;
+    }
+    size_t consumed = 0;
+    while (!conn->in.empty()) {
+        ServiceRequest req;
+        long used = service_parseRequest(conn->in.substr(consumed), req);
+        if (used == 0) break;
+        ServiceResponse res;
+        if (used < 0) {
+            service_error(res, conn->in.size() - consumed > SERVICE_MAX_REQUEST ? 413 : 400, "malformed or oversized request");
+            service_appendResponse(conn->out, res, false);
+            conn->close_after_write = true;
+            conn->in.clear();
+            return true;
+        }
+        service_handle(state, req, res);
+        consumed += (size_t)used;
+        service_appendResponse(conn->out, res, req.keep_alive);
+        if (!req.keep_alive) { conn->close_after_write = true; break; }
+        if (consumed == conn->in.size()) break;
+    }
+    conn->in.erase(0, consumed);
+    return true;
+}
+
+static int service_openListener(const ServiceOptions& options) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) { perror("Service mode: socket"); return -1; }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)options.port);
+    if (inet_pton(AF_INET, options.bind_address, &addr.sin_addr) != 1) {
+        std::cerr << "Service mode: '" << options.bind_address << "' is not an IPv4 address." << std::endl;
+        close(fd);
+        return -1;
+    }
+    if (bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 512) != 0) {
+        perror("Service mode: bind/listen");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int runServiceMode(const ServiceOptions& options) {
+    int listen_fd = service_openListener(options);
+    if (listen_fd < 0) return 1;
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) { perror("Service mode: epoll_create1"); close(listen_fd); return 1; }
+
+    // The same start-up the menus do: Task 1 from its checkpoint and journal or else the
+    // registration CSV, Task 4 resident and fed by Task 1's results. Matches are only
+    // scheduled on POST /schedule, since that rewrites matches.csv.
+    Tournament tournament;
+    Task4_GameResultManager results(150);
+    tournament.setMatchCompletedListener(&Task4_GameResultManager::onMatchCompleted, &results);
+    if (!tournament.openJournal(TASK1_CHECKPOINT_FILE, TASK1_JOURNAL_FILE)) tournament.initialize(SERVICE_REGISTRATION_CSV);
+    results.ensureDataLoaded();
+
+    ServiceState state;
+    state.tournament = &tournament;
+    state.results = &results;
+    state.registry.init();
+    Task2_readPlayersFromCSV(&state.registry, SERVICE_REGISTRATION_CSV);
+    Task2_CheckInPipeline::recover(&state.registry, SERVICE_REGISTRATION_CSV, TASK2_CHECKIN_LOG); // A Task 2 desk that never closed
+    state.next_player_id = Task2_highestPlayerID(&state.registry) + 1;
+    state.registry_dirty = false;
+    state.requests = 0;
+    // Registrations made through the API since the last checkpoint live only in the registry CSV.
+    struct Task2_Queue* const queues[5] = {&state.registry.earlyBirdQueue, &state.registry.wildcardQueue, &state.registry.standardQueue,
+                                           &state.registry.lastMinuteQueue, &state.registry.waitlistQueue};
+    for (int q = 0; q < 5; q++) {
+        for (struct Task2_Player* p = queues[q]->front; p; p = p->next) service_syncPlayer(state, p);
+    }
+    tournament.publishPendingChanges();
+
+    int listener_marker = 0;
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &listener_marker;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev);
+    bool listener_paused = false; // Out of descriptors or memory: taken out of epoll until one frees up
+    bool accept_error_reported = false; // Reported once per shortage, not once per retry
+
+    service_stop_requested = 0;
+    signal(SIGINT, service_onSignal);
+    signal(SIGTERM, service_onSignal);
+    std::cout << "\nService mode listening on http://" << options.bind_address << ":" << options.port
+              << " (Ctrl+C to stop)." << std::endl;
+
+    ServiceConnection* connections = nullptr;
+    int connection_count = 0;
+    epoll_event events[SERVICE_EVENTS_PER_WAIT];
+    while (!service_stop_requested) {
+        int ready = epoll_wait(epoll_fd, events, SERVICE_EVENTS_PER_WAIT, 1000);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            perror("Service mode: epoll_wait");
+            break;
+        }
+        bool closed_any = false;
+        for (int i = 0; i < ready; i++) {
+            if (events[i].data.ptr == &listener_marker) {
+                while (true) {
+                    int fd = accept4(listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (fd < 0) {
+                        if (errno == EAGAIN || errno == EWOULDBLOCK) break; // Backlog drained
+                        if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                            // The pending connection stays queued and the listener readable, so
+                            // stop watching it rather than spin until a descriptor frees up.
+                            if (!accept_error_reported) perror("Service mode: accept4");
+                            accept_error_reported = true;
+                            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, listen_fd, nullptr);
+                            listener_paused = true;
+                            break;
+                        }
+                        continue; // EINTR, or an error that belongs to that one aborted connection
+                    }
+                    accept_error_reported = false;
+                    if (connection_count >= options.max_connections) { close(fd); continue; }
+                    int one = 1;
+                    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                    ServiceConnection* conn = new ServiceConnection();
+                    conn->fd = fd;
+                    conn->out_sent = 0;
+                    conn->close_after_write = false;
+                    conn->want_write = false;
+                    conn->prev = nullptr;
+                    conn->next = connections;
+                    if (connections) connections->prev = conn;
+                    connections = conn;
+                    connection_count++;
+                    epoll_event add;
+                    add.events = EPOLLIN;
+                    add.data.ptr = conn;
+                    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &add);
+                }
+                continue;
+            }
+            ServiceConnection* conn = (ServiceConnection*)events[i].data.ptr;
+            bool keep = true;
+            if (events[i].events & EPOLLIN) keep = service_onReadable(state, conn);
+            else if (events[i].events & (EPOLLERR | EPOLLHUP)) keep = false;
+            if (keep) keep = service_flush(epoll_fd, conn);
+            if (!keep) {
+                service_closeConnection(epoll_fd, connections, conn);
+                connection_count--;
+                closed_any = true;
+            }
+        }
+        // Try accepting again once a connection has closed, or after a quiet second.
+        if (listener_paused && (closed_any || ready == 0)) {
+            epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev);
+            listener_paused = false;
+        }
+        // Group commit: one CSV rewrite and one tournament snapshot cover every change made in this pass.
+        tournament.publishPendingChanges();
+        if (state.registry_dirty) {
+            Task2_writePlayersToCSV(&state.registry, SERVICE_REGISTRATION_CSV);
+            state.registry_dirty = false;
+        }
+    }
+
+    std::cout << "\nService mode stopping after " << state.requests << " requests." << std::endl;
+    while (connections) service_closeConnection(epoll_fd, connections, connections);
+    close(epoll_fd);
+    close(listen_fd);
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+    Task2_writePlayersToCSV(&state.registry, SERVICE_REGISTRATION_CSV);
+    Task2_destroyRegistry(&state.registry);
+    return 0;
+}
+
+#else
+
+int runServiceMode(const ServiceOptions& options) {
+    (void)options;
+    std::cerr << "Service mode needs epoll and is only available on Linux." << std::endl;
+    return 1;
+}
+
+#endif
@@ -0,0 +1,242 @@
+// Task2_CheckInPipeline.cpp
+// Doors-open check-in ingestion: desks push events into a lock-free ring and one
+// applier thread batches them into the registry and the check-in log, so a desk
+// never waits on the disk.
+
+#include "../EsportsChampionship.hpp"
+
+// --- Task2_CheckInRing ---
+
+Task2_CheckInRing::Task2_CheckInRing(size_t capacity) : head(0) {
+    size_t slots = 2;
+    while (slots < capacity) slots <<= 1;
+    cells = MemoryTracker::allocateArray<Cell>(slots, MEMORY_TASK2_REGISTRATIONS);
+    for (size_t i = 0; i < slots; i++) cells[i].sequence.store(i, std::memory_order_relaxed);
+    mask = slots - 1;
+    tail.store(0, std::memory_order_relaxed);
+}
+
+Task2_CheckInRing::~Task2_CheckInRing() { MemoryTracker::releaseArray(cells); }
+
+size_t Task2_CheckInRing::capacity() const { return mask + 1; }
+
+// A cell is free for position pos when its sequence equals pos; producers race for
+// it with one CAS on tail and publish by setting the sequence to pos + 1.
+bool Task2_CheckInRing::push(const Task2_CheckInEvent& event) {
+    size_t pos = tail.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells[pos & mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        long long diff = (long long)sequence - (long long)pos;
+        if (diff == 0) {
+            if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false; // The consumer has not freed this cell yet: full
+        } else {
+            pos = tail.load(std::memory_order_relaxed);
+        }
+    }
+    cell->event = event;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool Task2_CheckInRing::pop(Task2_CheckInEvent& event) {
+    Cell* cell = &cells[head & mask];
+    if (cell->sequence.load(std::memory_order_acquire) != head + 1) return false;
+    event = cell->event;
+    cell->sequence.store(head + mask + 1, std::memory_order_release); // Free for the next lap
+    head++;
+    return true;
+}
+
+// --- Player index ---
+// Open addressing on the ID string over every player the registry holds. The
+// applier owns the registry while it runs, so the index cannot go stale.
+
+static size_t Task2_hashID(const char* id) {
+    size_t h = 14695981039346656037ULL; // FNV-1a
+    for (; *id; id++) h = (h ^ (unsigned char)*id) * 1099511628211ULL;
+    return h;
+}
+
+static void Task2_indexQueue(struct Task2_Player** slots, size_t mask, struct Task2_Queue* queue) {
+    for (struct Task2_Player* p = queue->front; p; p = p->next) {
+        if (!p->playerID[0] || !p->playerName[0]) continue; // Dropped by the next CSV save
+        size_t i = Task2_hashID(p->playerID) & mask;
+        while (slots[i]) i = (i + 1) & mask;
+        slots[i] = p;
+    }
+}
+
+static struct Task2_Player** Task2_buildIndex(struct Task2_PriorityQueue* pq, size_t& mask) {
+    size_t players = (size_t)pq->getSize() + (size_t)pq->getWaitlistQueue()->getSize();
+    size_t slots = 16;
+    while (slots < players * 2) slots <<= 1; // At most half full
+    struct Task2_Player** index = MemoryTracker::allocateArray<struct Task2_Player*>(slots, MEMORY_TASK2_REGISTRATIONS);
+    for (size_t i = 0; i < slots; i++) index[i] = NULL;
+    mask = slots - 1;
+    Task2_indexQueue(index, mask, &pq->earlyBirdQueue);
+    Task2_indexQueue(index, mask, &pq->wildcardQueue);
+    Task2_indexQueue(index, mask, &pq->standardQueue);
+    Task2_indexQueue(index, mask, &pq->lastMinuteQueue);
+    Task2_indexQueue(index, mask, &pq->waitlistQueue);
+    return index;
+}
+
+static struct Task2_Player* Task2_lookupID(struct Task2_Player** index, size_t mask, const char* playerID) {
+    for (size_t i = Task2_hashID(playerID) & mask; index[i]; i = (i + 1) & mask) {
+        if (strcmp(index[i]->playerID, playerID) == 0) return index[i];
+    }
+    return NULL;
+}
+
+// --- Task2_CheckInPipeline ---
+
+Task2_CheckInPipeline::Task2_CheckInPipeline(size_t ring_capacity, int csv_interval_ms)
+    : ring(ring_capacity), csv_interval_ms(csv_interval_ms), pq(NULL), csv_path(NULL), log_path(NULL),
+      index(NULL), index_mask(0), running(false), stop_requested(false), in_flight(0),
+      applied_count(0), duplicate_count(0), unknown_count(0), batch_count(0) {}
+
+Task2_CheckInPipeline::~Task2_CheckInPipeline() { stop(); }
+
+bool Task2_CheckInPipeline::start(struct Task2_PriorityQueue* registry, const char* csv, const char* log) {
+    if (running.load() || applier.joinable()) return false;
+    pq = registry;
+    csv_path = csv;
+    log_path = log;
+    if (recover(pq, csv_path, log_path) < 0) return false;
+    index = Task2_buildIndex(pq, index_mask);
+    stop_requested.store(false);
+    running.store(true);
+    applier = std::thread(&Task2_CheckInPipeline::applierLoop, this);
+    return true;
+}
+
+bool Task2_CheckInPipeline::submit(const char* playerID) {
+    in_flight.fetch_add(1);
+    bool pushed = false;
+    if (running.load()) {
+        Task2_CheckInEvent event;
+        strncpy(event.playerID, playerID, sizeof(event.playerID) - 1);
+        event.playerID[sizeof(event.playerID) - 1] = '\0';
+        event.at = (long long)time(NULL);
+        pushed = ring.push(event);
+    }
+    in_flight.fetch_sub(1);
+    return pushed;
+}
+
+void Task2_CheckInPipeline::stop() {
+    if (!applier.joinable()) return;
+    running.store(false);
+    while (in_flight.load() > 0) std::this_thread::yield(); // Let pushes already under way land
+    stop_requested.store(true);
+    applier.join();
+    MemoryTracker::releaseArray(index);
+    index = NULL;
+}
+
+bool Task2_CheckInPipeline::isRunning() const { return running.load(); }
+long long Task2_CheckInPipeline::applied() const { return applied_count.load(std::memory_order_relaxed); }
+long long Task2_CheckInPipeline::duplicates() const { return duplicate_count.load(std::memory_order_relaxed); }
+long long Task2_CheckInPipeline::unknown() const { return unknown_count.load(std::memory_order_relaxed); }
+long long Task2_CheckInPipeline::batches() const { return batch_count.load(std::memory_order_relaxed); }
+
+void Task2_CheckInPipeline::applierLoop() {
+    BufferedWriter log(64 * 1024);
+    if (!log.open(log_path, true)) printf("Task 2: Cannot open check-in log '%s'; check-ins are only saved with the CSV.\n", log_path);
+    Task2_CheckInEvent* batch = MemoryTracker::allocateArray<Task2_CheckInEvent>(BATCH, MEMORY_TASK2_REGISTRATIONS);
+    std::chrono::steady_clock::time_point last_save = std::chrono::steady_clock::now();
+    bool dirty = false;
+    int idle_spins = 0;
+    while (true) {
+        int count = 0;
+        while (count < BATCH && ring.pop(batch[count])) count++;
+        if (count > 0) {
+            applyBatch(batch, count, log);
+            dirty = true;
+            idle_spins = 0;
+        } else if (stop_requested.load()) {
+            break; // Producers are done and the ring is empty
+        } else if (++idle_spins < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        if (dirty && std::chrono::steady_clock::now() - last_save >= std::chrono::milliseconds(csv_interval_ms)) {
+            if (saveCSV(log)) dirty = false;
+            last_save = std::chrono::steady_clock::now();
+        }
+    }
+    if (dirty) saveCSV(log);
+    log.close();
+    MemoryTracker::releaseArray(batch);
+}
+
+void Task2_CheckInPipeline::applyBatch(Task2_CheckInEvent* events, int count, BufferedWriter& log) {
+    APUEC_SCOPED_TIMER("Task2 check-in batch");
+    long long applied_now = 0, duplicates_now = 0, unknown_now = 0;
+    for (int i = 0; i < count; i++) {
+        struct Task2_Player* p = Task2_lookupID(index, index_mask, events[i].playerID);
+        if (!p) { unknown_now++; continue; }
+        if (p->checkInStatus) { duplicates_now++; continue; }
+        p->checkInStatus = 1;
+        time_t at = (time_t)events[i].at;
+        struct tm* timeinfo = localtime(&at);
+        strftime(p->checkInTime, sizeof(p->checkInTime), "%Y-%m-%d %H:%M:%S", timeinfo);
+        log.write(p->playerID); log.put(',');
+        log.write(p->checkInTime); log.put('\n');
+        applied_now++;
+    }
+    if (log.isOpen() && !log.sync()) { // One write and one fsync per batch: applied check-ins survive a crash
+        printf("Task 2: Writing check-in log '%s' failed; the next CSV save still records the batch.\n", log_path);
+    }
+    applied_count.fetch_add(applied_now, std::memory_order_relaxed);
+    duplicate_count.fetch_add(duplicates_now, std::memory_order_relaxed);
+    unknown_count.fetch_add(unknown_now, std::memory_order_relaxed);
+    batch_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+// The log is only truncated once the CSV holds everything in it.
+bool Task2_CheckInPipeline::saveCSV(BufferedWriter& log) {
+    if (!Task2_writePlayersToCSV(pq, csv_path)) return false;
+    if (log.isOpen()) log.open(log_path);
+    return true;
+}
+
+int Task2_CheckInPipeline::recover(struct Task2_PriorityQueue* pq, const char* csv_path, const char* log_path) {
+    int replayed = replayLog(pq, log_path);
+    if (replayed > 0) {
+        printf("Task 2: Recovered %d check-ins from '%s'.\n", replayed, log_path);
+        if (!Task2_writePlayersToCSV(pq, csv_path)) return -1; // Keep the log until the CSV has them
+    }
+    remove(log_path); // Everything in it is in the CSV now, and a torn last line must not prefix new entries
+    return replayed;
+}
+
+int Task2_CheckInPipeline::replayLog(struct Task2_PriorityQueue* pq, const char* log_path) {
+    FILE* file = fopen(log_path, "r");
+    if (!file) return 0;
+    size_t mask;
+    struct Task2_Player** index = Task2_buildIndex(pq, mask);
+    char line[128];
+    int replayed = 0;
+    while (fgets(line, sizeof(line), file)) {
+        char* comma = strchr(line, ',');
+        if (!comma || !strchr(comma, '\n')) continue; // A torn last line from a crash
+        *comma = '\0';
+        char* when = comma + 1;
+        when[strcspn(when, "\r\n")] = '\0';
+        struct Task2_Player* p = Task2_lookupID(index, mask, line);
+        if (!p || p->checkInStatus || !when[0]) continue;
+        p->checkInStatus = 1;
+        strncpy(p->checkInTime, when, sizeof(p->checkInTime) - 1);
+        p->checkInTime[sizeof(p->checkInTime) - 1] = '\0';
+        replayed++;
+    }
+    fclose(file);
+    MemoryTracker::releaseArray(index);
+    return replayed;
+}
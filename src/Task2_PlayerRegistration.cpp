@@ -0,0 +1,878 @@
+// Task2_PlayerRegistration.cpp
+// Task 2: player registration, check-in, withdrawal and the waitlist.
+
+#include "../EsportsChampionship.hpp"
+
+// Task 2: Player Registration Implementations
+// Adapted from task2.cpp. Original comments preserved where applicable.
+
+// --- Start of Task 2 specific helper functions (formerly global in task2.cpp) ---
+// These are kept here for encapsulation within the Task 2 section.
+// If they were generic enough, they could be utility functions.
+
+// Helper: Player records come from the tracked allocator so they show up in the
+// memory report; like malloc, allocation returns NULL on failure.
+static struct Task2_Player* Task2_allocatePlayer() {
+    return (struct Task2_Player*)MemoryTracker::allocate(sizeof(struct Task2_Player), MEMORY_TASK2_REGISTRATIONS);
+}
+
+static void Task2_freePlayer(struct Task2_Player* player) {
+    MemoryTracker::release(player, sizeof(struct Task2_Player), MEMORY_TASK2_REGISTRATIONS);
+}
+
+// Helper: Convert input to lowercase and check for "yes"/"y"
+static int Task2_isYesResponse(const char* input) {
+    char lower[10];
+    int i;
+    for (i = 0; input[i] && i < 9; i++) {
+        lower[i] = tolower(input[i]);
+    }
+    lower[i] = '\0';
+    return strcmp(lower, "yes") == 0 || strcmp(lower, "y") == 0;
+}
+
+// Helper: Check if file exists
+static int Task2_fileExists(const char* filename) {
+    FILE* file = fopen(filename, "r");
+    if (file) {
+        fclose(file);
+        return 1;
+    }
+    return 0;
+}
+
+// Helper: Validate numeric string
+static int Task2_isNumeric(const char* str) {
+    if (!str || !str[0]) return 0;
+    for (int i = 0; str[i]; i++) {
+        if (!isdigit(str[i])) return 0;
+    }
+    return 1;
+}
+
+// Helper: Get last player ID from CSV
+static int Task2_getLastPlayerID(const char* filename) {
+    if (!Task2_fileExists(filename)) return 1000; // Start ID if file doesn't exist
+
+    FILE* file = fopen(filename, "r");
+    if (!file) return 1000; // Default if file cannot be opened
+
+    char line[256];
+    int maxID = 1000; // Min ID is 1001 effectively
+    if(fgets(line, sizeof(line), file) == NULL) { // Skip or check header
+        fclose(file);
+        return maxID; // Empty or unreadable file
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '\0' || line[0] == '\n' || line[0] == '\r') continue;
+        
+        // Use a copy for strtok as it modifies the string
+        char lineCopy[256];
+        strncpy(lineCopy, line, sizeof(lineCopy)-1);
+        lineCopy[sizeof(lineCopy)-1] = '\0';
+
+        char* token = strtok(lineCopy, ",");
+        if (token && Task2_isNumeric(token)) {
+            int id = atoi(token);
+            if (id > maxID) maxID = id;
+        }
+    }
+    fclose(file);
+    return maxID;
+}
+
+
+// Helper: Trim whitespace and normalize registration type to "Pascal-Case"
+static void Task2_normalizeRegistrationType(char* dest, const char* src, int maxLen) {
+    int i = 0, j = 0;
+    bool newWord = true;
+    if (!src) { dest[0] = '\0'; return; }
+
+    // Skip leading whitespace
+    while (src[i] != '\0' && isspace((unsigned char)src[i])) {
+        i++;
+    }
+
+    while (src[i] != '\0' && j < maxLen - 1) {
+        if (isspace((unsigned char)src[i]) || src[i] == '-') {
+            if (j > 0 && dest[j-1] != '-') { // Avoid multiple dashes
+                 dest[j++] = '-';
+            }
+            newWord = true;
+            i++;
+            while (src[i] != '\0' && (isspace((unsigned char)src[i]) || src[i] == '-')) { // Skip multiple separators
+                i++;
+            }
+            continue;
+        }
+        if (newWord) {
+            dest[j++] = toupper((unsigned char)src[i++]);
+            newWord = false;
+        } else {
+            dest[j++] = tolower((unsigned char)src[i++]);
+        }
+    }
+    // Remove trailing dash if any
+    if (j > 0 && dest[j-1] == '-') {
+        j--;
+    }
+    dest[j] = '\0';
+}
+
+
+// Clear input buffer (typically after scanf or when mixing with fgets)
+static void Task2_clearInputBuffer() {
+    int c;
+    while ((c = getchar()) != '\n' && c != EOF);
+}
+
+// Wait for Enter key press
+static void Task2_waitForEnter() {
+    printf("\n(Task 2: Press Enter to return to the Task 2 menu...)");
+    // getchar(); // Read the newline potentially left by previous scanf/fgets
+    // A more robust way if mixing cin and fgets is to use cin.ignore or ensure buffers are clear.
+    // For C-style, if last input was scanf, a clearInputBuffer might be needed before this.
+    // If last input was fgets, it consumes the newline.
+    // This getchar might consume a newline already consumed by fgets or wait for new input.
+    // Let's rely on clearInputBuffer being called after scanf.
+    char tempBuf[2]; // Read a character, primarily to pause.
+    fgets(tempBuf, sizeof(tempBuf), stdin); // Safely consumes one line or part of it
+}
+
+
+// Task2_Queue methods
+void Task2_Queue::init() {
+    front = NULL;
+    rear = NULL;
+    size = 0;
+}
+
+int Task2_Queue::isEmpty() {
+    return front == NULL;
+}
+
+void Task2_Queue::enqueue(struct Task2_Player* player) {
+    if (!player) return;
+    player->next = NULL;
+    if (isEmpty()) {
+        front = rear = player;
+    } else {
+        rear->next = player;
+        rear = player;
+    }
+    size++;
+}
+
+struct Task2_Player* Task2_Queue::dequeue() {
+    if (isEmpty()) return NULL;
+    struct Task2_Player* temp = front;
+    front = front->next;
+    if (front == NULL) rear = NULL;
+    size--;
+    temp->next = NULL; // Decouple the node
+    return temp;
+}
+
+struct Task2_Player* Task2_Queue::peek() {
+    return front;
+}
+
+int Task2_Queue::getSize() {
+    return size;
+}
+
+void Task2_Queue::destroy() {
+    while (!isEmpty()) {
+        struct Task2_Player* temp = dequeue();
+        Task2_freePlayer(temp); // Free the player struct memory
+    }
+    front = rear = NULL;
+    size = 0;
+}
+
+// Task2_PriorityQueue methods
+void Task2_PriorityQueue::init() {
+    earlyBirdQueue.init();
+    wildcardQueue.init();
+    standardQueue.init();
+    lastMinuteQueue.init();
+    waitlistQueue.init();
+    size = 0; // This size tracks main queue players, not waitlist.
+}
+
+void Task2_PriorityQueue::enqueue(struct Task2_Player* player) {
+    if (!player) return;
+    // Determine queue based on registration type (already normalized)
+    if (strcmp(player->registrationType, "Early-Bird") == 0) {
+        earlyBirdQueue.enqueue(player);
+    } else if (strcmp(player->registrationType, "Wildcard") == 0) {
+        wildcardQueue.enqueue(player);
+    } else if (strcmp(player->registrationType, "Standard") == 0) {
+        standardQueue.enqueue(player);
+    } else if (strcmp(player->registrationType, "Last-Minute") == 0) {
+        lastMinuteQueue.enqueue(player);
+    } else {
+        // Default to standard if type is unknown (should not happen if normalized correctly)
+        printf("Warning: Unknown registration type '%s' for player %s. Adding to Standard queue.\n", player->registrationType, player->playerName);
+        strcpy(player->registrationType, "Standard"); // Correct it
+        player->rank[0] = 'C'; player->rank[1] = '\0';
+        standardQueue.enqueue(player);
+    }
+    size++; // Increment total size of main queues
+}
+
+struct Task2_Player* Task2_PriorityQueue::dequeue() {
+    struct Task2_Player* player = NULL;
+    if (!earlyBirdQueue.isEmpty()) {
+        player = earlyBirdQueue.dequeue();
+    } else if (!wildcardQueue.isEmpty()) {
+        player = wildcardQueue.dequeue();
+    } else if (!standardQueue.isEmpty()) {
+        player = standardQueue.dequeue();
+    } else if (!lastMinuteQueue.isEmpty()) {
+        player = lastMinuteQueue.dequeue();
+    }
+
+    if (player != NULL) {
+        size--; // Decrement total size if a player was dequeued
+    }
+    return player;
+}
+
+int Task2_PriorityQueue::isEmpty() {
+    return earlyBirdQueue.isEmpty() && wildcardQueue.isEmpty() &&
+           standardQueue.isEmpty() && lastMinuteQueue.isEmpty();
+}
+
+int Task2_PriorityQueue::getSize() {
+    return size; // Returns size of main queues
+}
+
+struct Task2_Queue* Task2_PriorityQueue::getWaitlistQueue() {
+    return &waitlistQueue;
+}
+
+// This function takes ownership of players from q, q becomes empty.
+void Task2_PriorityQueue::setWaitlistQueue(struct Task2_Queue* q) {
+    waitlistQueue.destroy(); // Clear current waitlist
+    waitlistQueue.init();    // Re-initialize
+
+    while (!q->isEmpty()) {
+        Task2_Player* p = q->dequeue();
+        // No need to deep copy if q is giving up ownership
+        waitlistQueue.enqueue(p);
+    }
+    // q is now empty, its resources (nodes) are transferred or should be freed by its caller if nodes weren't transferred
+    // In task2.cpp, the source queue for setWaitlistQueue (tempWaitlist) typically holds nodes that were dequeued
+    // from the original waitlistQueue, so it's more of a transfer.
+}
+
+
+// Display waitlist
+static void Task2_displayWaitlist(struct Task2_PriorityQueue* pq) {
+    printf("\n+------------------------------------------------------------------------------------+\n");
+    printf("|                                 WAITLIST PLAYERS                                   |\n");
+    printf("+------------------------------------------------------------------------------------+\n");
+    printf("| %-9s | %-20s | %-15s | %-28s | %-4s |\n", "Player ID", "Player Name", "Reg. Type", "Email", "Rank");
+    printf("+-----------+----------------------+-----------------+------------------------------+------+\n");
+
+    struct Task2_Queue* waitlist = pq->getWaitlistQueue();
+    if (waitlist->isEmpty()) {
+        printf("| Waitlist is empty.                                                                 |\n");
+    } else {
+        struct Task2_Queue tempDisplayWaitlist; // To iterate without modifying original
+        tempDisplayWaitlist.init();
+        int count = 0;
+        while(!waitlist->isEmpty()){
+            Task2_Player* p = waitlist->dequeue();
+            char shortName[19] = {0};
+            char shortEmail[27] = {0};
+            snprintf(shortName, sizeof shortName, "%.15s...", p->playerName);
+            snprintf(shortEmail, sizeof shortEmail, "%.23s...", p->email);
+             printf("| %-9s | %-20s | %-15s | %-28s | %-4s |\n",
+                   p->playerID,
+                   (strlen(p->playerName) > 18 ? shortName : p->playerName),
+                   p->registrationType,
+                   (strlen(p->email) > 26 ? shortEmail : p->email),
+                   p->rank);
+            tempDisplayWaitlist.enqueue(p);
+            count++;
+        }
+        // Restore original waitlist
+        while(!tempDisplayWaitlist.isEmpty()){
+            waitlist->enqueue(tempDisplayWaitlist.dequeue());
+        }
+         printf("| Total on waitlist: %-59d |\n", count);
+    }
+    printf("+------------------------------------------------------------------------------------+\n");
+    Task2_waitForEnter();
+}
+
+// Read players from CSV into the priority queue system
+void Task2_readPlayersFromCSV(struct Task2_PriorityQueue* pq, const char* filename) {
+    APUEC_SCOPED_TIMER("Task2 readPlayersFromCSV");
+    if (!Task2_fileExists(filename)) {
+        printf("Task 2: CSV file '%s' not found. Starting with empty registration list.\n", filename);
+        // Create an empty file with header if it doesn't exist? Or let user know.
+        FILE* file = fopen(filename, "w"); // Create it
+        if(file){
+            fprintf(file, "Player ID,Player Name,Registration Type,Email,Rank,Check-In,Time of Check-In,Status\n");
+            fclose(file);
+            printf("Task 2: Created empty CSV file '%s' with headers.\n", filename);
+        } else {
+            printf("Task 2: Error: Could not create CSV file '%s'.\n", filename);
+        }
+        return;
+    }
+
+    FILE* file = fopen(filename, "r");
+    if (!file) {
+        printf("Task 2: Error opening CSV file '%s' for reading.\n", filename);
+        return;
+    }
+
+    char line[512]; // Increased buffer size
+    if (!fgets(line, sizeof(line), file)) { // Read header
+        printf("Task 2: Warning: CSV file '%s' is empty or header missing.\n", filename);
+        fclose(file);
+        return;
+    }
+    // Can validate header here if necessary
+
+    int playersRead = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '\n' || line[0] == '\0' || line[0] == '\r') continue; // Skip empty lines
+
+        // Remove newline character if present
+        line[strcspn(line, "\r\n")] = 0;
+
+        struct Task2_Player* player = Task2_allocatePlayer();
+        if (!player) { printf("Task 2: Memory allocation failed for player.\n"); break; }
+
+        // Initialize player struct
+        player->ranking = 0; player->teamID = 0; player->group = 0; player->next = NULL;
+        strcpy(player->checkInTime, "N/A"); player->rank[0] = '\0'; player->rank[1] = '\0';
+        player->playerID[0] = '\0'; player->playerName[0] = '\0'; player->registrationType[0] = '\0';
+        player->email[0] = '\0'; strcpy(player->status, "MAIN"); // Default to MAIN
+
+        char* token;
+        char* rest = line; // For strtok_r if available and preferred for safety, but sticking to strtok for C89 compat.
+                           // Or, use manual parsing for more robustness.
+
+        // Field: Player ID
+        token = strtok(rest, ","); if (token) strncpy(player->playerID, token, sizeof(player->playerID)-1); else continue;
+        player->playerID[sizeof(player->playerID)-1] = '\0';
+
+        // Field: Player Name
+        token = strtok(NULL, ","); if (token) strncpy(player->playerName, token, sizeof(player->playerName)-1); else { Task2_freePlayer(player); continue; }
+        player->playerName[sizeof(player->playerName)-1] = '\0';
+
+        // Field: Registration Type
+        token = strtok(NULL, ","); if (token) strncpy(player->registrationType, token, sizeof(player->registrationType)-1); else { Task2_freePlayer(player); continue; }
+        player->registrationType[sizeof(player->registrationType)-1] = '\0';
+
+        // Field: Email
+        token = strtok(NULL, ","); if (token) strncpy(player->email, token, sizeof(player->email)-1); else { Task2_freePlayer(player); continue; }
+        player->email[sizeof(player->email)-1] = '\0';
+
+        // Field: Rank
+        token = strtok(NULL, ","); if (token && token[0]) { player->rank[0] = token[0]; player->rank[1] = '\0';} else { player->rank[0] = '\0'; player->rank[1] = '\0';}
+
+        // Field: Check-In Status
+        token = strtok(NULL, ","); if (token) player->checkInStatus = (strcmp(token, "YES") == 0 || strcmp(token, "yes") == 0); else { Task2_freePlayer(player); continue; }
+
+        // Field: Time of Check-In
+        token = strtok(NULL, ","); if (token) strncpy(player->checkInTime, token, sizeof(player->checkInTime)-1); else strcpy(player->checkInTime, "N/A");
+        player->checkInTime[sizeof(player->checkInTime)-1] = '\0';
+        
+        // Field: Status (MAIN/WAITLIST)
+        token = strtok(NULL, ",\n\r"); // consume rest of line for status
+        if (token) strncpy(player->status, token, sizeof(player->status)-1); else strcpy(player->status, "MAIN"); // Default if missing
+        player->status[sizeof(player->status)-1] = '\0';
+
+
+        // Basic validation and deriving rank if missing
+        bool validPlayer = true;
+        if (!Task2_isNumeric(player->playerID) || atoi(player->playerID) < 1000) validPlayer = false;
+        if (strlen(player->playerName) == 0) validPlayer = false;
+        if (strlen(player->registrationType) == 0) validPlayer = false;
+        Task2_normalizeRegistrationType(player->registrationType, player->registrationType, sizeof(player->registrationType)); // Normalize it
+
+        if (player->rank[0] == '\0') { // If rank is missing from CSV, derive it
+            if (strcmp(player->registrationType, "Early-Bird") == 0) player->rank[0] = 'A';
+            else if (strcmp(player->registrationType, "Wildcard") == 0) player->rank[0] = 'B';
+            else if (strcmp(player->registrationType, "Standard") == 0) player->rank[0] = 'C';
+            else if (strcmp(player->registrationType, "Last-Minute") == 0) player->rank[0] = 'D';
+            else player->rank[0] = 'C'; // Default rank
+            player->rank[1] = '\0';
+        }
+
+        if (validPlayer) {
+            if (strcmp(player->status, "WAITLIST") == 0) {
+                pq->getWaitlistQueue()->enqueue(player);
+            } else {
+                pq->enqueue(player); // Enqueues into appropriate priority queue
+            }
+            playersRead++;
+        } else {
+            printf("Task 2: Invalid data for player (ID: %s, Name: %s). Skipping.\n", player->playerID, player->playerName);
+            Task2_freePlayer(player);
+        }
+    }
+    fclose(file);
+    printf("Task 2: Loaded %d players from '%s'. Main queue: %d, Waitlist: %d.\n", playersRead, filename, pq->getSize(), pq->getWaitlistQueue()->getSize());
+}
+
+
+// Helper: One CSV row per player; writeCsvField replaces commas with semicolons and drops non-printables
+static void Task2_writePlayerRow(BufferedWriter& out, const struct Task2_Player* player) {
+    out.writeCsvField(player->playerID); out.put(',');
+    out.writeCsvField(player->playerName); out.put(',');
+    out.writeCsvField(player->registrationType); out.put(',');
+    out.writeCsvField(player->email); out.put(',');
+    out.put(player->rank[0] ? player->rank[0] : 'N'); out.put(','); // Rank
+    out.write(player->checkInStatus ? "YES," : "NO,");                // Check-In
+    out.writeCsvField(player->checkInTime); out.put(',');
+    out.writeCsvField(player->status); out.put('\n');
+}
+
+// Write all players (main queues and waitlist) to CSV
+bool Task2_writePlayersToCSV(struct Task2_PriorityQueue* pq, const char* filename) {
+    APUEC_SCOPED_TIMER("Task2 writePlayersToCSV");
+    BufferedWriter out;
+    if (!out.openReplace(filename)) {
+        printf("Task 2: Error opening CSV file '%s' for writing!\n", filename);
+        return false;
+    }
+
+    out.write("Player ID,Player Name,Registration Type,Email,Rank,Check-In,Time of Check-In,Status\n");
+
+    struct Task2_PriorityQueue tempCopy; // To preserve original pq
+    tempCopy.init();
+
+    // Process main queues
+    while (!pq->isEmpty()) {
+        struct Task2_Player* player = pq->dequeue();
+        if (!player || strlen(player->playerID) == 0 || strlen(player->playerName) == 0) { // Basic check for valid player
+            if (player) Task2_freePlayer(player);
+            continue;
+        }
+        Task2_writePlayerRow(out, player);
+
+        tempCopy.enqueue(player); // Add to temp copy to restore later
+    }
+    // Restore players to original pq from tempCopy
+    while(!tempCopy.isEmpty()){
+        pq->enqueue(tempCopy.dequeue());
+    }
+
+    // Process waitlist queue
+    struct Task2_Queue* waitlist = pq->getWaitlistQueue();
+    struct Task2_Queue tempWaitlistCopy;
+    tempWaitlistCopy.init();
+
+    while (!waitlist->isEmpty()) {
+        struct Task2_Player* player = waitlist->dequeue();
+         if (!player || strlen(player->playerID) == 0 || strlen(player->playerName) == 0) {
+            if (player) Task2_freePlayer(player);
+            continue;
+        }
+        Task2_writePlayerRow(out, player); // Status should be "WAITLIST"
+
+        tempWaitlistCopy.enqueue(player);
+    }
+    // Restore waitlist
+     while(!tempWaitlistCopy.isEmpty()){
+        waitlist->enqueue(tempWaitlistCopy.dequeue());
+    }
+
+    if (!out.close()) {
+        printf("Task 2: Error writing CSV file '%s'!\n", filename);
+        return false;
+    }
+    // printf("Task 2: Player data successfully written to '%s'.\n", filename); // Optional: can be too verbose
+    return true;
+}
+
+// --- Registry operations shared by the menus below and the service mode ---
+// They only change the in-memory registry; the caller decides when to save the CSV.
+
+// Add a player under the given ID: MAIN while the main list has room, otherwise WAITLIST
+struct Task2_Player* Task2_addPlayer(struct Task2_PriorityQueue* pq, int playerID, const char* name,
+                                     const char* registrationType, const char* email) {
+    struct Task2_Player* player = Task2_allocatePlayer();
+    if (!player) return NULL;
+
+    // Initialize fields
+    player->ranking = 0; player->teamID = 0; player->checkInStatus = 0; player->group = 0; player->next = NULL;
+    strcpy(player->checkInTime, "N/A");
+    sprintf(player->playerID, "%d", playerID);
+    strncpy(player->playerName, name, sizeof(player->playerName)-1);
+    player->playerName[sizeof(player->playerName)-1] = '\0';
+    Task2_normalizeRegistrationType(player->registrationType, registrationType, sizeof(player->registrationType));
+    strncpy(player->email, email, sizeof(player->email)-1);
+    player->email[sizeof(player->email)-1] = '\0';
+
+    // Assign rank based on (normalized) registration type
+    if (strcmp(player->registrationType, "Early-Bird") == 0) player->rank[0] = 'A';
+    else if (strcmp(player->registrationType, "Wildcard") == 0) player->rank[0] = 'B';
+    else if (strcmp(player->registrationType, "Standard") == 0) player->rank[0] = 'C';
+    else if (strcmp(player->registrationType, "Last-Minute") == 0) player->rank[0] = 'D';
+    else { // Default if normalization failed or type is weird
+        printf("Warning: Unrecognized registration type '%s'. Defaulting to 'Standard', Rank C.\n", player->registrationType);
+        strcpy(player->registrationType, "Standard");
+        player->rank[0] = 'C';
+    }
+    player->rank[1] = '\0';
+
+    // Determine if player goes to main queue or waitlist (e.g., based on total main queue size)
+    // Original task2.cpp had a limit of 16 for main queue.
+    const int MAIN_QUEUE_LIMIT = 16; // Example limit
+    if (pq->getSize() < MAIN_QUEUE_LIMIT) {
+        strcpy(player->status, "MAIN");
+        pq->enqueue(player); // Adds to the correct priority queue within main
+    } else {
+        strcpy(player->status, "WAITLIST");
+        pq->getWaitlistQueue()->enqueue(player);
+    }
+    return player;
+}
+
+// Highest player ID held in memory (1000 when empty), for IDs issued without rereading the CSV
+int Task2_highestPlayerID(struct Task2_PriorityQueue* pq) {
+    int maxID = 1000;
+    struct Task2_Queue* queues[5] = {&pq->earlyBirdQueue, &pq->wildcardQueue, &pq->standardQueue,
+                                     &pq->lastMinuteQueue, &pq->waitlistQueue};
+    for (int q = 0; q < 5; q++) {
+        for (struct Task2_Player* p = queues[q]->front; p; p = p->next) {
+            int id = atoi(p->playerID);
+            if (id > maxID) maxID = id;
+        }
+    }
+    return maxID;
+}
+
+// Check in a player (main lists first, then the waitlist); NULL when the ID is unknown
+struct Task2_Player* Task2_checkInByID(struct Task2_PriorityQueue* pq, const char* playerID) {
+    APUEC_SCOPED_TIMER("Task2 checkInPlayer");
+    Task2_Player* foundPlayerPtr = NULL;
+
+    // Search in main priority queues
+    struct Task2_PriorityQueue tempSearchPq; tempSearchPq.init();
+    while (!pq->isEmpty()) {
+        Task2_Player* p = pq->dequeue();
+        if (strcmp(playerID, p->playerID) == 0) {
+            foundPlayerPtr = p;
+            if (!p->checkInStatus) { // If not already checked in
+                p->checkInStatus = 1;
+                time_t now = time(NULL);
+                struct tm* timeinfo = localtime(&now);
+                strftime(p->checkInTime, sizeof(p->checkInTime), "%Y-%m-%d %H:%M:%S", timeinfo);
+            }
+        }
+        tempSearchPq.enqueue(p); // Store to re-populate
+    }
+    while(!tempSearchPq.isEmpty()) pq->enqueue(tempSearchPq.dequeue()); // Restore pq
+
+    // If not found in main, search in waitlist
+    if (!foundPlayerPtr) {
+        Task2_Queue* waitlist = pq->getWaitlistQueue();
+        Task2_Queue tempSearchWaitlist; tempSearchWaitlist.init();
+        while(!waitlist->isEmpty()){
+            Task2_Player* p = waitlist->dequeue();
+            if (strcmp(playerID, p->playerID) == 0) {
+                foundPlayerPtr = p;
+                 if (!p->checkInStatus) {
+                    p->checkInStatus = 1;
+                    time_t now = time(NULL); struct tm* timeinfo = localtime(&now);
+                    strftime(p->checkInTime, sizeof(p->checkInTime), "%Y-%m-%d %H:%M:%S", timeinfo);
+                }
+            }
+            tempSearchWaitlist.enqueue(p);
+        }
+        while(!tempSearchWaitlist.isEmpty()) waitlist->enqueue(tempSearchWaitlist.dequeue()); // Restore waitlist
+    }
+    return foundPlayerPtr;
+}
+
+// Withdraw a player; a MAIN withdrawal promotes the first waitlisted player of the same rank
+struct Task2_WithdrawResult Task2_withdrawPlayer(struct Task2_PriorityQueue* pq, const char* playerIDToWithdraw) {
+    struct Task2_WithdrawResult result;
+    result.found = false;
+    result.fromWaitlist = false;
+    result.playerName[0] = '\0';
+    result.rank[0] = '\0'; // To know which rank to replace from waitlist
+    result.promoted = NULL;
+
+    // Search and withdraw from main priority queues
+    struct Task2_PriorityQueue tempProcessingPq; tempProcessingPq.init();
+    while (!pq->isEmpty()) {
+        Task2_Player* p = pq->dequeue();
+        if (strcmp(p->playerID, playerIDToWithdraw) == 0) {
+            result.found = true;
+            strncpy(result.rank, p->rank, sizeof(result.rank)-1); result.rank[sizeof(result.rank)-1] = '\0';
+            strncpy(result.playerName, p->playerName, sizeof(result.playerName)-1); result.playerName[sizeof(result.playerName)-1] = '\0';
+            Task2_freePlayer(p); // Player removed and memory freed
+        } else {
+            tempProcessingPq.enqueue(p);
+        }
+    }
+    while(!tempProcessingPq.isEmpty()) pq->enqueue(tempProcessingPq.dequeue()); // Restore non-withdrawn players
+
+    // If not found in main queues, check waitlist (though typically withdraw from main)
+    if (!result.found) {
+        Task2_Queue* waitlist = pq->getWaitlistQueue();
+        Task2_Queue tempWaitlist; tempWaitlist.init();
+        while(!waitlist->isEmpty()){
+            Task2_Player* p = waitlist->dequeue();
+            if (strcmp(p->playerID, playerIDToWithdraw) == 0) {
+                result.found = true; // Found on waitlist
+                result.fromWaitlist = true; // Withdrawing from the waitlist doesn't trigger promotion
+                strncpy(result.playerName, p->playerName, sizeof(result.playerName)-1); result.playerName[sizeof(result.playerName)-1] = '\0';
+                Task2_freePlayer(p);
+            } else {
+                tempWaitlist.enqueue(p);
+            }
+        }
+        while(!tempWaitlist.isEmpty()) waitlist->enqueue(tempWaitlist.dequeue()); // Restore waitlist
+    }
+
+    if (result.found && strlen(result.rank) > 0) { // If withdrawn from MAIN queue (rank was captured)
+        // Attempt to promote from waitlist if a main player was withdrawn
+        Task2_Queue* waitlist = pq->getWaitlistQueue();
+        Task2_Queue tempWaitlistProcessing; tempWaitlistProcessing.init();
+
+        // Find best candidate from waitlist (e.g., matching rank, then highest priority type)
+        // Original task2.cpp promoted if rank matched.
+        while(!waitlist->isEmpty()){
+            Task2_Player* pWaitlist = waitlist->dequeue();
+            if (!result.promoted && strcmp(pWaitlist->rank, result.rank) == 0) { // Found matching rank
+                result.promoted = pWaitlist; // This player will be promoted
+            } else {
+                tempWaitlistProcessing.enqueue(pWaitlist); // Others go to temp
+            }
+        }
+        // Restore non-promoted waitlist players
+        while(!tempWaitlistProcessing.isEmpty()) waitlist->enqueue(tempWaitlistProcessing.dequeue());
+
+        if (result.promoted) {
+            strcpy(result.promoted->status, "MAIN");
+            pq->enqueue(result.promoted); // Add to main priority queue system
+        }
+    }
+    return result;
+}
+
+// Free every player in the registry
+void Task2_destroyRegistry(struct Task2_PriorityQueue* pq) {
+    pq->earlyBirdQueue.destroy();
+    pq->wildcardQueue.destroy();
+    pq->standardQueue.destroy();
+    pq->lastMinuteQueue.destroy();
+    pq->waitlistQueue.destroy();
+}
+
+// --- Interactive wrappers ---
+
+// Register a new player
+static void Task2_registerPlayer(struct Task2_PriorityQueue* pq, const char* filename) {
+    int lastID = Task2_getLastPlayerID(filename);
+
+    printf("\n+------------------------------+\n");
+    printf("|  TASK 2: PLAYER REGISTRATION |\n");
+    printf("+------------------------------+\n");
+    printf("New Player ID: %d\n", lastID + 1);
+
+    char name[101], registrationType[101], email[101]; // For fgets
+
+    printf("Enter Player Name: ");
+    fgets(name, sizeof(name), stdin); name[strcspn(name, "\n")] = 0;
+
+    printf("Enter Registration Type (Early-Bird, Standard, Wildcard, Last-Minute): ");
+    fgets(registrationType, sizeof(registrationType), stdin); registrationType[strcspn(registrationType, "\n")] = 0;
+
+    printf("Enter Email: ");
+    fgets(email, sizeof(email), stdin); email[strcspn(email, "\n")] = 0;
+
+    struct Task2_Player* player = Task2_addPlayer(pq, lastID + 1, name, registrationType, email);
+    if (!player) { printf("Task 2: Memory allocation failed for new player.\n"); return; }
+    printf("Assigned Rank: %s based on Registration Type: %s\n", player->rank, player->registrationType);
+
+    if (strcmp(player->status, "MAIN") == 0) {
+        printf("\nPlayer '%s' registered successfully to MAIN list! Rank: %c. Total main queue: %d\n",
+               player->playerName, player->rank[0], pq->getSize());
+    } else {
+        printf("\nMain queue full. Player '%s' added to WAITLIST! Rank: %c. Total waitlist: %d\n",
+               player->playerName, player->rank[0], pq->getWaitlistQueue()->getSize());
+    }
+
+    Task2_writePlayersToCSV(pq, filename); // Save changes
+    Task2_waitForEnter();
+}
+
+// Check-in an existing player
+static void Task2_checkInPlayer(struct Task2_PriorityQueue* pq, const char* filename) {
+    char playerIDQuery[10];
+    char continueCheckIn[10];
+
+    printf("\n+------------------------------+\n");
+    printf("|    TASK 2: PLAYER CHECK-IN   |\n");
+    printf("+------------------------------+\n");
+
+    while (1) {
+        printf("Enter Player ID to check-in: ");
+        fgets(playerIDQuery, sizeof(playerIDQuery), stdin);
+        playerIDQuery[strcspn(playerIDQuery, "\n")] = 0;
+
+        while (strlen(playerIDQuery) == 0) {
+            printf("Player ID cannot be empty. Please enter Player ID: ");
+            fgets(playerIDQuery, sizeof(playerIDQuery), stdin);
+            playerIDQuery[strcspn(playerIDQuery, "\n")] = 0;
+        }
+
+        Task2_Player* foundPlayerPtr = Task2_checkInByID(pq, playerIDQuery);
+        if (foundPlayerPtr) {
+            printf("Player ID %s (%s) status: %s. Check-in: %s at %s.\n",
+                   playerIDQuery, foundPlayerPtr->playerName, foundPlayerPtr->status,
+                   (foundPlayerPtr->checkInStatus ? "CONFIRMED" : "NOT CHECKED IN (Error?)"),
+                   foundPlayerPtr->checkInTime);
+            Task2_writePlayersToCSV(pq, filename); // Save updated status
+        } else {
+            printf("Player ID %s not found in any registration list!\n", playerIDQuery);
+        }
+
+        printf("\nCheck in another player? (yes/no): ");
+        fgets(continueCheckIn, sizeof(continueCheckIn), stdin);
+        if (!Task2_isYesResponse(continueCheckIn)) break;
+    }
+    Task2_waitForEnter();
+}
+
+// Doors-open check-in desk: scanned IDs go into Task2_CheckInPipeline and the prompt is back at
+// once; the applier checks players in and logs them in batches, and the CSV is rewritten at most
+// once a second rather than per scan. The pipeline owns the registry until the desk closes.
+static void Task2_runCheckInDesk(struct Task2_PriorityQueue* pq, const char* filename) {
+    Task2_CheckInPipeline desk;
+    if (!desk.start(pq, filename, TASK2_CHECKIN_LOG)) {
+        printf("Could not open the check-in desk: saving '%s' failed.\n", filename);
+        return;
+    }
+    printf("\n+------------------------------+\n");
+    printf("|   TASK 2: CHECK-IN DESK      |\n");
+    printf("+------------------------------+\n");
+    printf("Scan or type one Player ID per line; an empty line closes the desk.\n");
+
+    char line[64];
+    long long scanned = 0;
+    while (fgets(line, sizeof(line), stdin)) {
+        if (!strchr(line, '\n') && !feof(stdin)) Task2_clearInputBuffer(); // Longer than any ID
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0') break;
+        while (!desk.submit(line)) std::this_thread::yield(); // Ring full: the applier is catching up
+        scanned++;
+    }
+    desk.stop(); // Applies what is queued and saves the CSV
+    printf("Desk closed after %lld scans: %lld checked in, %lld already checked in, %lld unknown IDs.\n",
+           scanned, desk.applied(), desk.duplicates(), desk.unknown());
+}
+
+// Withdraw a player and report the waitlist promotion
+static void Task2_withdrawPlayerLogic(struct Task2_PriorityQueue* pq, const char* playerIDToWithdraw, const char* filename) {
+    struct Task2_WithdrawResult result = Task2_withdrawPlayer(pq, playerIDToWithdraw);
+
+    if (result.found && strlen(result.rank) > 0) { // If withdrawn from MAIN queue (rank was captured)
+        printf("Player %s (%s) withdrawn successfully from MAIN list.\n", playerIDToWithdraw, result.playerName);
+        if (result.promoted) {
+            printf("Player %s (%s, Rank: %s) promoted from waitlist to MAIN list.\n",
+                   result.promoted->playerID, result.promoted->playerName, result.promoted->rank);
+        } else {
+            printf("No suitable player (Rank: %s) found on waitlist for promotion.\n", result.rank);
+        }
+        Task2_writePlayersToCSV(pq, filename); // Save changes
+    } else if (result.found) { // Found and withdrawn (likely from waitlist, or rank not captured)
+         if (result.fromWaitlist) printf("Player %s (%s) was on the WAITLIST and has been withdrawn.\n", playerIDToWithdraw, result.playerName);
+         printf("Player %s (%s) withdrawn. No promotion from waitlist triggered by this withdrawal.\n", playerIDToWithdraw, result.playerName);
+         Task2_writePlayersToCSV(pq, filename);
+    }else {
+        printf("Player ID %s not found in any registration list for withdrawal.\n", playerIDToWithdraw);
+    }
+}
+
+// UI wrapper for player withdrawal
+static void Task2_handleWithdrawPlayer(struct Task2_PriorityQueue* pq, const char* filename) {
+    char playerIDQuery[10];
+    printf("\n+------------------------------+\n");
+    printf("|   TASK 2: PLAYER WITHDRAWAL  |\n");
+    printf("+------------------------------+\n");
+    printf("Enter Player ID to withdraw: ");
+    fgets(playerIDQuery, sizeof(playerIDQuery), stdin);
+    playerIDQuery[strcspn(playerIDQuery, "\n")] = 0;
+
+    if (strlen(playerIDQuery) > 0) {
+        Task2_withdrawPlayerLogic(pq, playerIDQuery, filename);
+    } else {
+        printf("Player ID cannot be empty.\n");
+    }
+    Task2_waitForEnter();
+}
+
+
+// Main function for Task 2 module
+void Task2_runPlayerRegistrationSystem() {
+    struct Task2_PriorityQueue task2_pqManager; // Manager for Task 2 queues
+    task2_pqManager.init();
+    const char* task2_csvFilename = "Player_Registration.csv"; // CSV filename for Task 2
+
+    printf("\n--- Task 2: Player Registration System Initializing ---\n");
+    Task2_readPlayersFromCSV(&task2_pqManager, task2_csvFilename); // Load existing data
+    Task2_CheckInPipeline::recover(&task2_pqManager, task2_csvFilename, TASK2_CHECKIN_LOG); // A desk that never closed
+    printf("Current number of main registered players: %d. Waitlisted: %d\n",
+           task2_pqManager.getSize(), task2_pqManager.getWaitlistQueue()->getSize());
+
+    int choice;
+    do {
+        printf("\n\n+------------------------------------------+\n");
+        printf("|      APUEC Player Registration (Task 2)  |\n");
+        printf("+------------------------------------------+\n");
+        printf("| 1. Register New Player                   |\n");
+        printf("| 2. Check-In Existing Player              |\n");
+        printf("| 3. Withdraw Player                       |\n");
+        printf("| 4. View Waitlist                         |\n");
+        printf("| 5. Open Check-In Desk (doors open)       |\n");
+        printf("| 6. Save & Return to Main APUEC Menu      |\n");
+        printf("+------------------------------------------+\n");
+        printf("Enter choice (1-6): ");
+
+        int fields = scanf("%d", &choice);
+        if (fields == EOF) { choice = 6; printf("\n"); } // Input has ended: save and leave
+        else if (fields != 1) {
+            Task2_clearInputBuffer(); // Clear invalid input
+            printf("Invalid input! Please enter a number between 1 and 6.\n");
+            choice = 0; // Reset choice to loop again
+            continue;
+        }
+        Task2_clearInputBuffer(); // Clear newline after scanf
+
+        switch (choice) {
+            case 1: Task2_registerPlayer(&task2_pqManager, task2_csvFilename); break;
+            case 2: Task2_checkInPlayer(&task2_pqManager, task2_csvFilename); break;
+            case 3: Task2_handleWithdrawPlayer(&task2_pqManager, task2_csvFilename); break;
+            case 4: Task2_displayWaitlist(&task2_pqManager); break;
+            case 5: Task2_runCheckInDesk(&task2_pqManager, task2_csvFilename); break;
+            case 6:
+                Task2_writePlayersToCSV(&task2_pqManager, task2_csvFilename); // Ensure data is saved on exit
+                printf("\nPlayer registration data saved. Exiting Task 2...\n");
+                break;
+            default:
+                printf("Invalid choice! Please enter a number between 1 and 6.\n");
+                break;
+        }
+    } while (choice != 6);
+
+    // Clean up: Destroy queues to free player data memory
+    Task2_destroyRegistry(&task2_pqManager);
+    // task2_pqManager itself is stack-allocated, so no `free(task2_pqManager)`.
+     printf("--- Task 2: Player Registration System Closed ---\n");
+}
+// --- End of Task 2 Implementations ---
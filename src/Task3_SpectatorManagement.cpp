@@ -0,0 +1,1137 @@
+// Task3_SpectatorManagement.cpp
+// Task 3: spectator registration, seating and live stream queues.
+
+#include "../EsportsChampionship.hpp"
+
+using namespace std;
+
+// Task 3: Spectator Management Implementations
+// Merged from WENDY_FINAL/Task3.cpp. Lives in namespace Task3 so Task3::Match
+// does not clash with the Task 1 Match; matches come from the live Tournament.
+namespace Task3 {
+
+// -------- Spectator Class --------
+Spectator::Spectator(const string& _id, const string& _name, bool _wantsLiveStream,
+                     const string& _supportedPlayer, const string& _category, const string& _day)
+    : id(_id), name(_name), supportedPlayer(_supportedPlayer), category(_category), day(_day),
+      wantsLiveStream(_wantsLiveStream), active(true), listIndex(-1), next(nullptr) {
+    assignPaymentAmount();
+}
+
+void Spectator::assignPaymentAmount() {
+    if (category == "VIP") paymentAmount = 500;
+    else if (category == "Influencer") paymentAmount = 350;
+    else paymentAmount = 200;
+}
+
+// -------- SpectatorList (Linked List) --------
+SpectatorList::SpectatorList() : head(nullptr), nextId(1), count(0) {}
+SpectatorList::~SpectatorList() { clear(); }
+
+Spectator* SpectatorList::getHead() const { return head; }
+int SpectatorList::size() const { return count; }
+
+Spectator* SpectatorList::findById(const string& id) const {
+    Spectator* cur = head;
+    while (cur && cur->id != id) cur = cur->next;
+    return cur;
+}
+
+void SpectatorList::append(Spectator* newNode) {
+    newNode->listIndex = count++;
+    if (!head) head = newNode;
+    else {
+        Spectator* temp = head;
+        while (temp->next) temp = temp->next;
+        temp->next = newNode;
+    }
+}
+
+void SpectatorList::clear() {
+    Spectator* current = head;
+    while (current) {
+        Spectator* temp = current;
+        current = current->next;
+        delete temp;
+    }
+    head = nullptr;
+    nextId = 1;
+    count = 0;
+}
+
+// Auto-generate ID and return it
+string SpectatorList::registerSpectator(const string& name, bool wantsLiveStream,
+                                        const string& supportedPlayer, const string& category, const string& day) {
+    stringstream ss;
+    ss << "S" << setfill('0') << setw(3) << nextId++;
+    string id = ss.str();
+    append(new Spectator(id, name, wantsLiveStream, supportedPlayer, category, day));
+    return id; // return generated ID
+}
+
+void SpectatorList::loadFromCSV(const char* filename) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cout << "No existing spectators file found, starting fresh.\n";
+        return;
+    }
+    clear(); // Clear any existing data before loading new data
+
+    string line;
+    getline(file, line); // skip header
+
+    int maxIdNum = 0;
+    while (getline(file, line)) {
+        if (!line.empty() && line[line.size() - 1] == '\r') line.erase(line.size() - 1);
+        if (line.empty()) continue;
+        stringstream ss(line);
+        string id, name, category, wantsLiveStreamStr, supportedPlayer, day, paymentStr;
+        getline(ss, id, ',');
+        getline(ss, name, ',');
+        getline(ss, category, ',');
+        getline(ss, wantsLiveStreamStr, ',');
+        getline(ss, supportedPlayer, ',');
+        getline(ss, day, ',');
+        getline(ss, paymentStr, ',');
+
+        bool wantsLiveStream = (wantsLiveStreamStr == "Yes" || wantsLiveStreamStr == "yes");
+        append(new Spectator(id, name, wantsLiveStream, supportedPlayer, category, day));
+
+        // Robust parsing of numeric part of ID
+        if (!id.empty() && id[0] == 'S') {
+            try {
+                string numericPart = id.substr(1);
+                // Remove leading zeros
+                size_t pos = numericPart.find_first_not_of('0');
+                if (pos != string::npos) {
+                    numericPart = numericPart.substr(pos);
+                } else {
+                    numericPart = "0";
+                }
+                int num = stoi(numericPart);
+                if (num > maxIdNum) maxIdNum = num;
+            } catch (...) {}
+        }
+    }
+    file.close();
+    nextId = maxIdNum + 1;  // Next new ID after max found
+}
+
+void SpectatorList::saveToCSV(const char* filename) const {
+    ofstream file(filename);
+    if (!file.is_open()) {
+        cout << "Failed to open " << filename << " for writing\n";
+        return;
+    }
+    file << "spectator_id,name,category,wants_live_stream,supported_player,day,payment_amount\r\n";
+    for (Spectator* sptr = head; sptr; sptr = sptr->next) {
+        file << sptr->id << "," << sptr->name << "," << sptr->category << ","
+             << (sptr->wantsLiveStream ? "Yes" : "No") << "," << sptr->supportedPlayer << ","
+             << sptr->day << "," << sptr->paymentAmount << "\r\n";
+    }
+    file.close();
+    cout << "Spectator data saved to " << filename << "\n";
+}
+
+void SpectatorList::displaySpectators() const {
+    Spectator* temp = head;
+    cout << "\n[All Spectators]:\n";
+    while (temp) {
+        cout << "ID: " << temp->id
+             << ", Name: " << temp->name
+             << ", Category: " << temp->category
+             << ", Wants Live Stream: " << (temp->wantsLiveStream ? "Yes" : "No")
+             << ", Supported Player: " << temp->supportedPlayer
+             << ", Attendance Day: " << temp->day
+             << ", Payment:RM " << temp->paymentAmount
+             << ", Active: " << (temp->active ? "Yes" : "No") << "\n";
+        temp = temp->next;
+    }
+}
+
+void SpectatorList::displayActiveSpectators(const string& roundName) const {
+    cout << "\n[Active Spectators - " << roundName << "]:\n";
+    Spectator* temp = head;
+    int number = 1;
+    while (temp) {
+        if (temp->active) {
+            cout << number++ << ". ID: " << temp->id << ", Name: " << temp->name
+                 << " (Supports Player ID: " << temp->supportedPlayer << ")\n";
+        }
+        temp = temp->next;
+    }
+}
+
+// -------- Match Class --------
+Match::Match(int id, const string& t1, const string& t2, const string& sched, const string& stg,
+             int rnd, const string& sts, const string& winner)
+    : matchId(id), team1(t1), team2(t2), scheduledTime(sched), stage(stg), round(rnd),
+      status(sts), winnerId(winner), next(nullptr) {}
+
+Match::Match(const ::Match& live)
+    : matchId(live.getId()),
+      team1(live.getPlayer1() ? to_string(live.getPlayer1()->getId()) : "0"),
+      team2(live.getPlayer2() ? to_string(live.getPlayer2()->getId()) : "0"),
+      scheduledTime(live.getScheduledTime()), stage(live.getStage()), round(live.getRound()),
+      status(live.getStatus()), winnerId(live.getWinner() ? to_string(live.getWinner()->getId()) : ""),
+      next(nullptr) {}
+
+// -------- MatchList (Linked List) --------
+MatchList::MatchList()
+    : head(nullptr), tail(nullptr), count(0), dayTable(nullptr), dayTableSize(0), dayMatches(nullptr),
+      dayMatchCount(0) {}
+MatchList::~MatchList() { clear(); }
+
+Match* MatchList::getHead() const { return head; }
+int MatchList::size() const { return count; }
+
+void MatchList::clear() {
+    Match* cur = head;
+    while (cur) {
+        Match* tmp = cur;
+        cur = cur->next;
+        delete tmp;
+    }
+    head = tail = nullptr;
+    count = 0;
+    clearDayIndex();
+}
+
+void MatchList::append(Match* newNode) {
+    if (!head) head = tail = newNode;
+    else {
+        tail->next = newNode;
+        tail = newNode;
+    }
+    count++;
+}
+
+// Mirrors the matches the tournament currently holds in memory, so results
+// entered in Task 1 are visible without a round trip through matches.csv.
+void MatchList::loadFromTournament(const Tournament& tournament) {
+    clear();
+    for (int i = 0; i < tournament.getMatchCount(); i++) {
+        ::Match* live = tournament.getMatch(i);
+        if (live) append(new Match(*live));
+    }
+    buildDayIndex();
+}
+
+void MatchList::loadFromCSV(const char* filename) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cout << "Cannot open file: " << filename << "\n";
+        return;
+    }
+    clear();
+    string line;
+    getline(file, line); // skip header
+    while (getline(file, line)) {
+        if (!line.empty() && line[line.size() - 1] == '\r') line.erase(line.size() - 1);
+        if (line.empty()) continue;
+        stringstream ss(line);
+        string idStr, stage, groupId, roundStr, p1, p2, sched, status, winnerId, score;
+        getline(ss, idStr, ',');
+        getline(ss, stage, ',');
+        getline(ss, groupId, ','); // ignore
+        getline(ss, roundStr, ',');
+        getline(ss, p1, ',');
+        getline(ss, p2, ',');
+        getline(ss, sched, ',');
+        getline(ss, status, ',');
+        getline(ss, winnerId, ',');
+        getline(ss, score, ',');
+
+        append(new Match(atoi(idStr.c_str()), p1, p2, sched, stage, atoi(roundStr.c_str()), status, winnerId));
+    }
+    file.close();
+    buildDayIndex();
+}
+
+// -------- Day index --------
+// Registration lists the group stage round 1 matches of one day and then picks
+// one by its position in that listing. The index groups those matches by day
+// once per load (counting pass, then a fill pass into one array), so listing a
+// day and picking a match are O(1) lookups rather than walks over every match.
+static string dayOf(const string& scheduledTime) {
+    size_t space = scheduledTime.find(' ');
+    return space == string::npos ? scheduledTime : scheduledTime.substr(0, space);
+}
+
+unsigned int MatchList::hashDay(const string& day) {
+    unsigned int h = 2166136261u; // FNV-1a
+    for (size_t i = 0; i < day.size(); i++) {
+        h ^= (unsigned char)day[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+int MatchList::findDay(const string& day) const {
+    if (!dayTable || day.empty()) return -1;
+    unsigned int mask = (unsigned int)dayTableSize - 1;
+    for (unsigned int i = hashDay(day) & mask; !dayTable[i].day.empty(); i = (i + 1) & mask) {
+        if (dayTable[i].day == day) return (int)i;
+    }
+    return -1;
+}
+
+void MatchList::clearDayIndex() {
+    delete[] dayTable;
+    MemoryTracker::releaseArray(dayMatches);
+    dayTable = nullptr;
+    dayMatches = nullptr;
+    dayTableSize = 0;
+    dayMatchCount = 0;
+}
+
+void MatchList::buildDayIndex() {
+    clearDayIndex();
+    dayTableSize = 16;
+    while (dayTableSize < count * 2) dayTableSize *= 2; // load factor <= 0.5
+    dayTable = new DayBucket[dayTableSize];
+    for (int i = 0; i < dayTableSize; i++) dayTable[i].first = dayTable[i].count = 0;
+    unsigned int mask = (unsigned int)dayTableSize - 1;
+
+    // Pass 1: count the matches of each day
+    int indexed = 0;
+    for (Match* cur = head; cur; cur = cur->next) {
+        if (cur->stage != "group" || cur->round != 1) continue;
+        string day = dayOf(cur->scheduledTime);
+        if (day.empty()) continue;
+        unsigned int i = hashDay(day) & mask;
+        while (!dayTable[i].day.empty() && dayTable[i].day != day) i = (i + 1) & mask;
+        if (dayTable[i].day.empty()) dayTable[i].day = day;
+        dayTable[i].count++;
+        indexed++;
+    }
+
+    // Give every day a contiguous run, then pass 2 fills it in list order
+    int offset = 0;
+    for (int i = 0; i < dayTableSize; i++) {
+        dayTable[i].first = offset;
+        offset += dayTable[i].count;
+        dayTable[i].count = 0;
+    }
+    dayMatches = MemoryTracker::allocateArray<Match*>(indexed > 0 ? indexed : 1, MEMORY_TASK3_QUEUES);
+    dayMatchCount = indexed;
+    for (Match* cur = head; cur; cur = cur->next) {
+        if (cur->stage != "group" || cur->round != 1) continue;
+        int slot = findDay(dayOf(cur->scheduledTime));
+        if (slot != -1) dayMatches[dayTable[slot].first + dayTable[slot].count++] = cur;
+    }
+}
+
+int MatchList::countMatchesOnDay(const string& day) const {
+    int slot = findDay(day);
+    return slot == -1 ? 0 : dayTable[slot].count;
+}
+
+int MatchList::countGroupStageRound1Matches() const { return dayMatchCount; }
+
+Match* MatchList::getMatchOnDay(const string& day, int position) const {
+    int slot = findDay(day);
+    if (slot == -1 || position < 1 || position > dayTable[slot].count) return nullptr;
+    return dayMatches[dayTable[slot].first + position - 1];
+}
+
+int MatchList::printGroupStageRound1Matches(const string& day) const {
+    int total = countMatchesOnDay(day);
+    for (int i = 1; i <= total; i++) {
+        Match* cur = getMatchOnDay(day, i);
+        cout << "Match " << i << ": Player " << cur->team1 << " vs Player " << cur->team2
+             << ", Scheduled: " << cur->scheduledTime << ", Round: " << cur->round << "\n";
+    }
+    return total;
+}
+
+// -------- StringSet (linked list based set) --------
+StringSet::Node::Node(const string& v) : val(v), next(nullptr) {}
+StringSet::StringSet() : head(nullptr) {}
+StringSet::~StringSet() {
+    Node* cur = head;
+    while (cur) {
+        Node* tmp = cur;
+        cur = cur->next;
+        delete tmp;
+    }
+}
+
+bool StringSet::contains(const string& s) const {
+    Node* cur = head;
+    while (cur) {
+        if (cur->val == s) return true;
+        cur = cur->next;
+    }
+    return false;
+}
+
+void StringSet::insert(const string& s) {
+    if (contains(s)) return;
+    Node* newNode = new Node(s);
+    newNode->next = head;
+    head = newNode;
+}
+
+// -------- Priority Seating Queue (linked list) --------
+PrioritySeatingQueue::Node::Node(Spectator* sp) : data(sp), next(nullptr) {}
+PrioritySeatingQueue::PrioritySeatingQueue() : front(nullptr) {}
+PrioritySeatingQueue::~PrioritySeatingQueue() {
+    while (front) {
+        Node* tmp = front;
+        front = front->next;
+        delete tmp;
+    }
+}
+
+int PrioritySeatingQueue::getPriority(const string& category) {
+    if (category == "VIP") return 1;
+    if (category == "Influencer") return 2;
+    return 3;
+}
+
+void PrioritySeatingQueue::enqueue(Spectator* sp) {
+    Node* newNode = new Node(sp);
+    if (!front || getPriority(sp->category) < getPriority(front->data->category)) {
+        newNode->next = front;
+        front = newNode;
+    } else {
+        Node* current = front;
+        while (current->next && getPriority(sp->category) >= getPriority(current->next->data->category)) {
+            current = current->next;
+        }
+        newNode->next = current->next;
+        current->next = newNode;
+    }
+}
+
+void PrioritySeatingQueue::displayQueue() const {
+    cout << "\n[Seating Queue - Priority Order]:\n";
+    Node* temp = front;
+    int pos = 1;
+    while (temp) {
+        cout << pos++ << ". " << temp->data->name << " (" << temp->data->category << ")\n";
+        temp = temp->next;
+    }
+}
+
+// -------- MultiLevelLiveStreamQueue (linked list) --------
+// Three FIFO tiers (Influencer, VIP, General). Each tier keeps its own head/tail
+// pointer and counter so enqueue, dequeue and the capacity check are all O(1).
+// dequeue() admits viewers using smooth weighted round-robin across the tiers,
+// so a busy General tier still gets a share of the slots instead of starving.
+MultiLevelLiveStreamQueue::Node::Node(Spectator* sp) : data(sp), next(nullptr) {}
+MultiLevelLiveStreamQueue::Tier::Tier() : head(nullptr), tail(nullptr), count(0), weight(1), currentWeight(0) {}
+
+MultiLevelLiveStreamQueue::MultiLevelLiveStreamQueue(int cap, int influencerWeight, int vipWeight, int generalWeight)
+    : totalCount(0), capacity(cap) {
+    setWeights(influencerWeight, vipWeight, generalWeight);
+}
+
+MultiLevelLiveStreamQueue::~MultiLevelLiveStreamQueue() {
+    for (int t = 0; t < TIER_COUNT; t++) {
+        Node* cur = tiers[t].head;
+        while (cur) {
+            Node* tmp = cur;
+            cur = cur->next;
+            delete tmp;
+        }
+    }
+}
+
+int MultiLevelLiveStreamQueue::tierFor(const string& category) {
+    if (category == "Influencer") return INFLUENCER;
+    if (category == "VIP") return VIP;
+    return GENERAL;
+}
+
+// Weights below 1 are clamped to 1 so every tier is eventually served.
+void MultiLevelLiveStreamQueue::setWeights(int influencerWeight, int vipWeight, int generalWeight) {
+    tiers[INFLUENCER].weight = influencerWeight > 0 ? influencerWeight : 1;
+    tiers[VIP].weight = vipWeight > 0 ? vipWeight : 1;
+    tiers[GENERAL].weight = generalWeight > 0 ? generalWeight : 1;
+    for (int t = 0; t < TIER_COUNT; t++) tiers[t].currentWeight = 0;
+}
+
+bool MultiLevelLiveStreamQueue::isFull() const { return totalCount >= capacity; }
+bool MultiLevelLiveStreamQueue::isEmpty() const { return totalCount == 0; }
+int MultiLevelLiveStreamQueue::getTotalCount() const { return totalCount; }
+
+bool MultiLevelLiveStreamQueue::enqueue(Spectator* sp) {
+    if (isFull()) {
+        cout << "Live stream full, " << sp->name << " cannot join.\n";
+        return false;
+    }
+    Tier& tier = tiers[tierFor(sp->category)];
+    Node* newNode = new Node(sp);
+    if (!tier.tail) tier.head = tier.tail = newNode;
+    else {
+        tier.tail->next = newNode;
+        tier.tail = newNode;
+    }
+    tier.count++;
+    totalCount++;
+    return true;
+}
+
+// Admits the next viewer. Every non-empty tier earns its weight in credit,
+// the richest tier is served and pays back the total weight in play.
+Spectator* MultiLevelLiveStreamQueue::dequeue() {
+    if (isEmpty()) return nullptr;
+    int best = -1;
+    int activeWeight = 0;
+    for (int t = 0; t < TIER_COUNT; t++) {
+        if (!tiers[t].head) continue;
+        tiers[t].currentWeight += tiers[t].weight;
+        activeWeight += tiers[t].weight;
+        if (best == -1 || tiers[t].currentWeight > tiers[best].currentWeight) best = t;
+    }
+    Tier& tier = tiers[best];
+    tier.currentWeight -= activeWeight;
+
+    Node* node = tier.head;
+    Spectator* sp = node->data;
+    tier.head = node->next;
+    if (!tier.head) {
+        tier.tail = nullptr;
+        tier.currentWeight = 0; // an emptied tier does not bank credit
+    }
+    delete node;
+    tier.count--;
+    totalCount--;
+    return sp;
+}
+
+void MultiLevelLiveStreamQueue::displayQueue() const {
+    cout << "\n[Live Stream Queue - Priority Groups] (" << totalCount << "/" << capacity << "):\n";
+    int number = 1;
+    number = displayGroup("Influencers", tiers[INFLUENCER], number);
+    number = displayGroup("VIPs", tiers[VIP], number);
+    displayGroup("Generals", tiers[GENERAL], number);
+}
+
+int MultiLevelLiveStreamQueue::displayGroup(const string& label, const Tier& tier, int number) const {
+    cout << "-- " << label << " (" << tier.count << ", weight " << tier.weight << ") --\n";
+    Node* head = tier.head;
+    while (head) {
+        cout << number++ << ". " << head->data->name << "\n";
+        head = head->next;
+    }
+    return number;
+}
+
+// -------- CircularStreamRotation (linked list) --------
+CircularStreamRotation::Node::Node(Spectator* sp) : data(sp), next(nullptr) {}
+CircularStreamRotation::CircularStreamRotation(int cap) : tail(nullptr), size(0), capacity(cap) {}
+
+CircularStreamRotation::~CircularStreamRotation() {
+    if (!tail) return;
+    Node* current = tail->next;
+    tail->next = nullptr;
+    while (current) {
+        Node* tmp = current;
+        current = current->next;
+        delete tmp;
+    }
+}
+
+bool CircularStreamRotation::isFull() const { return size == capacity; }
+bool CircularStreamRotation::isEmpty() const { return size == 0; }
+
+void CircularStreamRotation::enqueue(Spectator* sp) {
+    if (isFull()) {
+        cout << "Rotation full, cannot add: " << sp->name << "\n";
+        return;
+    }
+    Node* newNode = new Node(sp);
+    if (!tail) {
+        tail = newNode;
+        tail->next = tail;
+    } else {
+        newNode->next = tail->next;
+        tail->next = newNode;
+        tail = newNode;
+    }
+    size++;
+}
+
+Spectator* CircularStreamRotation::dequeue() {
+    if (isEmpty()) return nullptr;
+    Node* head = tail->next;
+    Spectator* sp = head->data;
+    if (tail == head) { // only one node
+        delete head;
+        tail = nullptr;
+    } else {
+        tail->next = head->next;
+        delete head;
+    }
+    size--;
+    return sp;
+}
+
+void CircularStreamRotation::displayQueue() const {
+    cout << "\n[Circular Live Stream Rotation]:\n";
+    if (isEmpty()) {
+        cout << "(empty)\n";
+        return;
+    }
+    Node* current = tail->next;
+    int number = 1;
+    do {
+        cout << number++ << ". " << current->data->name << "\n";
+        current = current->next;
+    } while (current != tail->next);
+}
+
+// -------- WatchHistoryStack (per-spectator ring buffers) --------
+// Keeps the last K watch events of every spectator. All rings live in one
+// arena allocated up front (spectators x K), so pushing is O(1), does not
+// allocate, and memory stays flat however long the championship runs; once a
+// ring is full the oldest event is overwritten. Rows are addressed by
+// Spectator::listIndex, and a spectator registered after the arena was sized
+// doubles it (amortised O(1)).
+WatchHistoryStack::WatchHistoryStack(int spectatorCount, int eventsPerSpectator)
+    : rowCount(spectatorCount > 0 ? spectatorCount : 1),
+      perSpectator(eventsPerSpectator > 0 ? eventsPerSpectator : 1), totalPushed(0) {
+    arena = MemoryTracker::allocateArray<WatchEvent>((size_t)rowCount * perSpectator, MEMORY_TASK3_QUEUES);
+    writePos = MemoryTracker::allocateArray<int>(rowCount, MEMORY_TASK3_QUEUES);
+    used = MemoryTracker::allocateArray<int>(rowCount, MEMORY_TASK3_QUEUES);
+    owners = MemoryTracker::allocateArray<Spectator*>(rowCount, MEMORY_TASK3_QUEUES);
+    for (int i = 0; i < rowCount; i++) {
+        writePos[i] = used[i] = 0;
+        owners[i] = nullptr;
+    }
+}
+
+WatchHistoryStack::~WatchHistoryStack() {
+    MemoryTracker::releaseArray(arena);
+    MemoryTracker::releaseArray(writePos);
+    MemoryTracker::releaseArray(used);
+    MemoryTracker::releaseArray(owners);
+}
+
+bool WatchHistoryStack::validRow(const Spectator* sp) const {
+    return sp && sp->listIndex >= 0 && sp->listIndex < rowCount;
+}
+
+void WatchHistoryStack::grow(int minRows) {
+    int rows = rowCount;
+    while (rows < minRows) rows *= 2;
+    WatchEvent* newArena = MemoryTracker::allocateArray<WatchEvent>((size_t)rows * perSpectator, MEMORY_TASK3_QUEUES);
+    int* newWritePos = MemoryTracker::allocateArray<int>(rows, MEMORY_TASK3_QUEUES);
+    int* newUsed = MemoryTracker::allocateArray<int>(rows, MEMORY_TASK3_QUEUES);
+    Spectator** newOwners = MemoryTracker::allocateArray<Spectator*>(rows, MEMORY_TASK3_QUEUES);
+    for (size_t i = 0; i < (size_t)rowCount * perSpectator; i++) newArena[i] = arena[i];
+    for (int i = 0; i < rows; i++) {
+        newWritePos[i] = i < rowCount ? writePos[i] : 0;
+        newUsed[i] = i < rowCount ? used[i] : 0;
+        newOwners[i] = i < rowCount ? owners[i] : nullptr;
+    }
+    MemoryTracker::releaseArray(arena);
+    MemoryTracker::releaseArray(writePos);
+    MemoryTracker::releaseArray(used);
+    MemoryTracker::releaseArray(owners);
+    arena = newArena;
+    writePos = newWritePos;
+    used = newUsed;
+    owners = newOwners;
+    rowCount = rows;
+}
+
+bool WatchHistoryStack::push(Spectator* sp, int matchId, long long startedAt, int seconds) {
+    if (!sp || sp->listIndex < 0) return false;
+    if (sp->listIndex >= rowCount) grow(sp->listIndex + 1); // Registered after the arena was sized
+    int row = sp->listIndex;
+    WatchEvent& ev = arena[(size_t)row * perSpectator + writePos[row]];
+    ev.matchId = matchId;
+    ev.startedAt = startedAt;
+    ev.seconds = seconds;
+    writePos[row] = (writePos[row] + 1) % perSpectator;
+    if (used[row] < perSpectator) used[row]++;
+    owners[row] = sp;
+    totalPushed++;
+    return true;
+}
+
+int WatchHistoryStack::countFor(const Spectator* sp) const { return validRow(sp) ? used[sp->listIndex] : 0; }
+
+// Event i of the spectator's history, 0 being the most recent.
+bool WatchHistoryStack::getFromTop(const Spectator* sp, int i, WatchEvent& out) const {
+    if (!validRow(sp) || i < 0 || i >= used[sp->listIndex]) return false;
+    int row = sp->listIndex;
+    int slot = (writePos[row] - 1 - i + perSpectator) % perSpectator;
+    out = arena[(size_t)row * perSpectator + slot];
+    return true;
+}
+
+void WatchHistoryStack::displayFor(const Spectator* sp) const {
+    if (!sp) return;
+    cout << sp->id << " " << sp->name << " watched (latest first):\n";
+    WatchEvent ev;
+    int n = countFor(sp);
+    if (n == 0) cout << "  (nothing yet)\n";
+    for (int i = 0; i < n && getFromTop(sp, i, ev); i++) {
+        cout << "  " << (i + 1) << ". t=" << ev.startedAt << "s for " << ev.seconds << "s";
+        if (ev.matchId) cout << " (match " << ev.matchId << ")";
+        cout << "\n";
+    }
+}
+
+void WatchHistoryStack::display() const {
+    cout << "\n[Watch History - last " << perSpectator << " per spectator, "
+         << totalPushed << " events logged]:\n";
+    bool any = false;
+    for (int row = 0; row < rowCount; row++) {
+        if (!owners[row]) continue;
+        displayFor(owners[row]);
+        any = true;
+    }
+    if (!any) cout << "(empty)\n";
+}
+
+// -------- WaitingQueue (linked list queue) --------
+WaitingQueue::Node::Node(Spectator* sp) : data(sp), next(nullptr) {}
+WaitingQueue::WaitingQueue() : front(nullptr), rear(nullptr), count(0) {}
+
+WaitingQueue::~WaitingQueue() {
+    while (front) {
+        Node* tmp = front;
+        front = front->next;
+        delete tmp;
+    }
+}
+
+bool WaitingQueue::isEmpty() const { return front == nullptr; }
+int WaitingQueue::size() const { return count; }
+
+void WaitingQueue::enqueue(Spectator* sp) {
+    Node* newNode = new Node(sp);
+    if (!rear) {
+        front = rear = newNode;
+    } else {
+        rear->next = newNode;
+        rear = newNode;
+    }
+    count++;
+}
+
+Spectator* WaitingQueue::dequeue() {
+    if (!front) return nullptr;
+    Node* tmp = front;
+    Spectator* sp = tmp->data;
+    front = front->next;
+    if (!front) rear = nullptr;
+    delete tmp;
+    count--;
+    return sp;
+}
+
+// -------- SimulatedClock --------
+SimulatedClock::SimulatedClock(long long start) : nowSeconds(start) {}
+long long SimulatedClock::now() const { return nowSeconds; }
+void SimulatedClock::advance(long long seconds) { if (seconds > 0) nowSeconds += seconds; }
+
+// -------- StreamRotationScheduler (timer wheel) --------
+// Time-sliced live stream rotation. Each viewer on stream holds a slot for
+// slotSeconds; slots sit in a hashed timer wheel with one bucket per second.
+// Because every slot has the same length, a wheel of slotSeconds + 1 buckets
+// never holds two laps at once, so a tick only touches the bucket that is due:
+// O(1) per tick plus O(1) per slot that expires on it. Expired viewers go to
+// the back of the waiting queue and the front of the queue is promoted into
+// the freed slot. Slots come from a pool sized to the rotation capacity, so the
+// steady state does not allocate on stream.
+StreamRotationScheduler::StreamRotationScheduler(int cap, int slotLengthSeconds, SimulatedClock& clk)
+    : freeCount(0), capacity(cap > 0 ? cap : 1),
+      slotSeconds(slotLengthSeconds > 0 ? slotLengthSeconds : 1),
+      currentTick(clk.now()), expiredTotal(0), promotedTotal(0), verbose(false),
+      streamMatchId(0), history(nullptr), clock(clk) {
+    slots = MemoryTracker::allocateArray<Slot>(capacity, MEMORY_TASK3_QUEUES);
+    freeSlots = MemoryTracker::allocateArray<int>(capacity, MEMORY_TASK3_QUEUES);
+    for (int i = capacity - 1; i >= 0; i--) {
+        slots[i].viewer = nullptr;
+        slots[i].expiresAt = 0;
+        slots[i].prev = slots[i].next = -1;
+        freeSlots[freeCount++] = i;
+    }
+    wheelSize = slotSeconds + 1;
+    wheel = MemoryTracker::allocateArray<int>(wheelSize, MEMORY_TASK3_QUEUES);
+    wheelTail = MemoryTracker::allocateArray<int>(wheelSize, MEMORY_TASK3_QUEUES);
+    for (int i = 0; i < wheelSize; i++) wheel[i] = wheelTail[i] = -1;
+}
+
+StreamRotationScheduler::~StreamRotationScheduler() {
+    MemoryTracker::releaseArray(slots);
+    MemoryTracker::releaseArray(freeSlots);
+    MemoryTracker::releaseArray(wheel);
+    MemoryTracker::releaseArray(wheelTail);
+}
+
+void StreamRotationScheduler::setVerbose(bool on) { verbose = on; }
+void StreamRotationScheduler::setHistory(WatchHistoryStack* h) { history = h; }
+void StreamRotationScheduler::setStreamMatch(int matchId) { streamMatchId = matchId; }
+int StreamRotationScheduler::onStreamCount() const { return capacity - freeCount; }
+int StreamRotationScheduler::waitingCount() const { return waiting.size(); }
+long long StreamRotationScheduler::expiredCount() const { return expiredTotal; }
+long long StreamRotationScheduler::promotedCount() const { return promotedTotal; }
+long long StreamRotationScheduler::now() const { return currentTick; }
+
+void StreamRotationScheduler::linkIntoBucket(int idx) {
+    int bucket = (int)(slots[idx].expiresAt % wheelSize);
+    slots[idx].prev = wheelTail[bucket];
+    slots[idx].next = -1;
+    if (wheelTail[bucket] != -1) slots[wheelTail[bucket]].next = idx;
+    else wheel[bucket] = idx;
+    wheelTail[bucket] = idx;
+}
+
+void StreamRotationScheduler::startSlot(Spectator* sp) {
+    int idx = freeSlots[--freeCount];
+    slots[idx].viewer = sp;
+    slots[idx].expiresAt = currentTick + slotSeconds;
+    linkIntoBucket(idx);
+}
+
+// Fill free slots from the waiting queue, skipping viewers who have left.
+void StreamRotationScheduler::promoteWaiting() {
+    while (freeCount > 0 && !waiting.isEmpty()) {
+        Spectator* next = waiting.dequeue();
+        if (!next->active) continue;
+        startSlot(next);
+        promotedTotal++;
+        if (verbose) cout << "  [t=" << currentTick << "s] " << next->name << " promoted to live stream\n";
+    }
+}
+
+void StreamRotationScheduler::processTick() {
+    int bucket = (int)(currentTick % wheelSize);
+    int idx = wheel[bucket];
+    wheel[bucket] = wheelTail[bucket] = -1;
+    while (idx != -1) {
+        int nextIdx = slots[idx].next;
+        Spectator* sp = slots[idx].viewer;
+        slots[idx].viewer = nullptr;
+        freeSlots[freeCount++] = idx;
+        expiredTotal++;
+        if (verbose) cout << "  [t=" << currentTick << "s] " << sp->name << "'s slot expired\n";
+        if (history) history->push(sp, streamMatchId, currentTick - slotSeconds, slotSeconds);
+        if (sp->active) waiting.enqueue(sp); // rejoin the back of the line
+        idx = nextIdx;
+    }
+    promoteWaiting();
+}
+
+// Puts the viewer on stream immediately if a slot is free, otherwise in line.
+void StreamRotationScheduler::addViewer(Spectator* sp) {
+    if (!sp || !sp->active) return;
+    if (freeCount > 0 && waiting.isEmpty()) startSlot(sp);
+    else waiting.enqueue(sp);
+}
+
+// Catch up with the simulated clock, one wheel tick per elapsed second.
+void StreamRotationScheduler::advanceTo(long long targetSeconds) {
+    while (currentTick < targetSeconds) {
+        currentTick++;
+        processTick();
+    }
+}
+
+void StreamRotationScheduler::run(long long seconds) {
+    clock.advance(seconds);
+    advanceTo(clock.now());
+}
+
+void StreamRotationScheduler::displayQueue() const {
+    cout << "\n[Timed Live Stream Rotation] t=" << currentTick << "s, slot " << slotSeconds << "s, "
+         << onStreamCount() << "/" << capacity << " on stream, " << waiting.size() << " waiting\n";
+    int number = 1;
+    for (int i = 0; i < capacity; i++) {
+        if (!slots[i].viewer) continue;
+        cout << number++ << ". " << slots[i].viewer->name << " (slot ends t="
+             << slots[i].expiresAt << "s)\n";
+    }
+    if (number == 1) cout << "(empty)\n";
+}
+
+// -------- Update spectators based on match results --------
+void updateSpectatorsByMatchResults(SpectatorList& spectators, MatchList& matches,
+                                    const string& stage, int round) {
+    StringSet winners;
+    Match* cur = matches.getHead();
+    while (cur) {
+        if (cur->stage == stage && cur->round == round && cur->status == "completed") {
+            winners.insert(cur->winnerId);
+        }
+        cur = cur->next;
+    }
+
+    Spectator* sp = spectators.getHead();
+    while (sp) {
+        if (sp->active && !winners.contains(sp->supportedPlayer)) {
+            sp->active = false;
+            cout << "Spectator " << sp->name << " left because supported player " << sp->supportedPlayer << " lost.\n";
+        }
+        sp = sp->next;
+    }
+}
+
+// -------- Simulate queue management --------
+void simulateQueueManagement(SpectatorList& regList) {
+    PrioritySeatingQueue seatQueue;
+    MultiLevelLiveStreamQueue streamQueue(10);
+    CircularStreamRotation rotation(5);
+    WatchHistoryStack history(regList.size(), 4);
+    WaitingQueue waitingQueue;
+
+    Spectator* ptr = regList.getHead();
+    while (ptr) {
+        if (!ptr->active) {
+            ptr = ptr->next;
+            continue;
+        }
+        seatQueue.enqueue(ptr);
+        if (ptr->wantsLiveStream) {
+            streamQueue.enqueue(ptr);
+            if (!rotation.isFull()) {
+                rotation.enqueue(ptr);
+            } else {
+                cout << ptr->name << " added to waiting queue for rotation\n";
+                waitingQueue.enqueue(ptr);
+            }
+        }
+        ptr = ptr->next;
+    }
+
+    seatQueue.displayQueue();
+    streamQueue.displayQueue();
+    rotation.displayQueue();
+
+    cout << "\nAdmitting live stream viewers (weighted Influencer/VIP/General)...\n";
+    int admitted = 0;
+    Spectator* viewer = streamQueue.dequeue();
+    while (viewer) {
+        cout << ++admitted << ". Admitted: " << viewer->name << " (" << viewer->category << ")\n";
+        viewer = streamQueue.dequeue();
+    }
+    if (admitted == 0) cout << "(no viewers waiting for the live stream)\n";
+
+    // Hand the rotation and its waiting line over to the timed scheduler and
+    // play a few slots on the simulated clock.
+    const int slotSeconds = 30;
+    SimulatedClock streamClock;
+    StreamRotationScheduler scheduler(5, slotSeconds, streamClock);
+    Spectator* onStream = rotation.dequeue();
+    while (onStream) {
+        scheduler.addViewer(onStream);
+        onStream = rotation.dequeue();
+    }
+    Spectator* queued = waitingQueue.dequeue();
+    while (queued) {
+        scheduler.addViewer(queued);
+        queued = waitingQueue.dequeue();
+    }
+
+    cout << "\nRunning timed live stream rotation (" << slotSeconds << "s slots, 3 rounds)...\n";
+    scheduler.setVerbose(true);
+    scheduler.setHistory(&history);
+    scheduler.run(3 * slotSeconds);
+    cout << "Slots expired: " << scheduler.expiredCount()
+         << ", promotions from waiting queue: " << scheduler.promotedCount() << "\n";
+    scheduler.displayQueue();
+    history.display();
+}
+
+// -------- Menu and helper functions --------
+static void displayMenu() {
+    cout << "\n--- Tournament Spectator System Menu ---\n";
+    cout << "1. Register new spectators\n";
+    cout << "2. Display all spectators\n";
+    cout << "3. Display active spectators by round\n";
+    cout << "4. Update spectators by match results\n";
+    cout << "5. Simulate queue management\n";
+    cout << "6. Save spectators to file\n";
+    cout << "7. Back to main menu\n";
+    cout << "Enter your choice: ";
+}
+
+// Reads a number in [low, high], asking again on anything else. False once
+// input has ended, so a closed stdin cannot spin the prompt.
+static bool readChoice(const string& prompt, int low, int high, int& choice) {
+    while (true) {
+        cout << prompt;
+        if (cin >> choice) {
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            if (choice >= low && choice <= high) return true;
+            continue;
+        }
+        if (cin.eof()) return false;
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+}
+
+static void registerSpectators(SpectatorList& registrationList, MatchList& matches) {
+    if (matches.countGroupStageRound1Matches() == 0) {
+        cout << "No group stage round 1 matches are scheduled yet; schedule them in Task 1 first.\n";
+        return;
+    }
+    int numSpectators;
+    if (!readChoice("Enter number of spectators to register: ", 0, numeric_limits<int>::max(), numSpectators)) return;
+
+    for (int i = 0; i < numSpectators; i++) {
+        string name, supportedTeam, supportedPlayer, category, day;
+        bool wantsLiveStream = false;
+        string wantsLiveStreamStr;
+        int paymentChoice = 3;
+
+        cout << "\nEnter details for Spectator #" << (i + 1) << "\n";
+
+        cout << "Name: ";
+        if (!getline(cin, name)) return;
+
+        bool cancelled = false;
+        while (true) {
+            cout << "Enter attendance date (YYYY-MM-DD, blank to cancel): ";
+            if (!getline(cin, day) || day.empty()) {
+                cancelled = true;
+                break;
+            }
+
+            cout << "\nMatches on " << day << " (Group Stage Round 1):\n";
+            int matchCount = matches.printGroupStageRound1Matches(day);
+            if (matchCount == 0) {
+                cout << "No group stage matches on that day, please choose another date.\n";
+                continue;
+            }
+
+            int matchChoice = 0;
+            if (!readChoice("Select a match to watch (1-" + to_string(matchCount) + "): ", 1, matchCount, matchChoice)) {
+                cancelled = true;
+                break;
+            }
+
+            Match* selectedMatch = matches.getMatchOnDay(day, matchChoice);
+
+            cout << "Choose a team to support:\n";
+            cout << "1. " << selectedMatch->team1 << "\n";
+            cout << "2. " << selectedMatch->team2 << "\n";
+
+            int teamChoice = 0;
+            if (!readChoice("Enter choice (1 or 2): ", 1, 2, teamChoice)) {
+                cancelled = true;
+                break;
+            }
+
+            supportedTeam = (teamChoice == 1) ? selectedMatch->team1 : selectedMatch->team2;
+            supportedPlayer = supportedTeam;
+            break;
+        }
+        if (cancelled) {
+            cout << "Registration cancelled; spectators already entered are kept.\n";
+            return;
+        }
+
+        cout << "Choose payment tier:\n1. VIP (RM500)\n2. Influencer (RM350)\n3. General (RM200)\nEnter choice: ";
+        if (!(cin >> paymentChoice)) {
+            if (cin.eof()) return;
+            cin.clear();
+            paymentChoice = 0;
+        }
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+
+        switch (paymentChoice) {
+            case 1: category = "VIP"; break;
+            case 2: category = "Influencer"; break;
+            case 3: category = "General"; break;
+            default:
+                category = "General";
+                cout << "Invalid choice, defaulting to General.\n";
+        }
+
+        cout << "Wants live stream (Yes/No): ";
+        if (!getline(cin, wantsLiveStreamStr)) return;
+        wantsLiveStream = (wantsLiveStreamStr == "Yes" || wantsLiveStreamStr == "yes");
+
+        string generatedId = registrationList.registerSpectator(name, wantsLiveStream, supportedPlayer, category, day);
+        cout << "Spectator registered successfully! Your Spectator ID is: " << generatedId << "\n";
+    }
+}
+
+static void displayActiveSpectatorsByRound(SpectatorList& registrationList) {
+    cout << "Enter round name (e.g., Round 1, Knockout Round 1): ";
+    string roundName;
+    getline(cin, roundName);
+    registrationList.displayActiveSpectators(roundName);
+}
+
+static void updateSpectatorsByRound(SpectatorList& registrationList, MatchList& matches) {
+    cout << "Enter stage (group/knockout): ";
+    string stage;
+    if (!getline(cin, stage)) return;
+
+    int round;
+    if (!readChoice("Enter round number: ", 1, numeric_limits<int>::max(), round)) return;
+
+    updateSpectatorsByMatchResults(registrationList, matches, stage, round);
+}
+
+} // namespace Task3
+
+// Task 3 entry point from the main APUEC menu. Spectators persist in
+// spectators.csv; matches are taken from the live Task 1 tournament on every
+// action so results recorded there are picked up without re-reading a file.
+static void refreshTask3Matches(Task3::MatchList& matches, const Tournament& tournament) {
+    if (tournament.getMatchCount() > 0) matches.loadFromTournament(tournament);
+    else matches.loadFromCSV("matches.csv"); // Task 1 has not scheduled anything yet
+}
+
+void runTask3_SpectatorManagement(Tournament& tournament) {
+    cout << "\n--- Task 3: Spectator Management ---" << endl;
+    Task3::SpectatorList registrationList;
+    Task3::MatchList matches;
+
+    registrationList.loadFromCSV("spectators.csv");
+
+    bool exitProgram = false;
+    while (!exitProgram) {
+        Task3::displayMenu();
+        int choice;
+        if (!(cin >> choice)) {
+            choice = cin.eof() ? 7 : 0; // Input has ended: save and leave
+            cin.clear();
+        }
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+
+        switch (choice) {
+            case 1:
+                refreshTask3Matches(matches, tournament);
+                Task3::registerSpectators(registrationList, matches);
+                registrationList.saveToCSV("spectators.csv"); // Save after registration
+                break;
+            case 2:
+                registrationList.displaySpectators();
+                break;
+            case 3:
+                Task3::displayActiveSpectatorsByRound(registrationList);
+                break;
+            case 4:
+                refreshTask3Matches(matches, tournament);
+                Task3::updateSpectatorsByRound(registrationList, matches);
+                break;
+            case 5:
+                Task3::simulateQueueManagement(registrationList);
+                break;
+            case 6:
+                registrationList.saveToCSV("spectators.csv");
+                break;
+            case 7:
+                registrationList.saveToCSV("spectators.csv"); // Save on exit as well
+                cout << "Returning to main APUEC menu.\n";
+                exitProgram = true;
+                break;
+            default:
+                cout << "Invalid choice, please try again.\n";
+        }
+    }
+}
+// --- End of Task 3 Implementations ---
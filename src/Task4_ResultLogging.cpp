@@ -0,0 +1,1053 @@
+// Task4_ResultLogging.cpp
+// Task 4: Task4_GameResultManager, which loads, updates and reports results.
+
+#include "../EsportsChampionship.hpp"
+
+// Task4_GameResultManager implementations
+Task4_GameResultManager::Task4_GameResultManager(int mp)
+    : task4_max_players(mp), current_player_count(0), next_match_id(1), data_loaded(false) { // next_match_id for if this system *generates* matches
+    player_stats = new Task4_PlayerStats[task4_max_players];
+    // Stacks and Queues are member objects, their constructors are called automatically.
+}
+
+Task4_GameResultManager::~Task4_GameResultManager() {
+    delete[] player_stats;
+}
+
+// Loads player data from "players.csv" (Task 1 format assumed)
+// Fields: ID,Name,RegistrationType,Email,Rank,CheckInStatus... (Task 4 uses ID, Name, RegType, Email, Rank)
+bool Task4_GameResultManager::loadPlayerData(const std::string& filename) {
+    APUEC_SCOPED_TIMER("Task4 loadPlayerData");
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Task 4 Warning: Cannot open players file '" << filename << "' for reading." << std::endl;
+        return false;
+    }
+
+    std::string line_str; // Renamed line from original
+    int loaded_count = 0;
+    bool header_skipped = false;
+
+    current_player_count = 0; // Reset before loading, crucial for re-runs
+    player_index.clear();
+    leaderboard.clear();
+
+    while (std::getline(file, line_str) && current_player_count < task4_max_players) {
+        if (line_str.empty() || line_str.find_first_not_of(" \t\r\n") == std::string::npos) continue; // Skip blank lines
+        if (!header_skipped) { header_skipped = true; continue; } // Skip header row
+
+        std::string tokens[6]; // Expecting: ID,Name,RegistrationType,Email,Rank,CheckInStatus
+        splitCSVLine(line_str, tokens, 6); // splitCSVLine handles trimming
+
+        if (tokens[0].empty()) { std::cerr << "Task 4 Warning: Empty player ID in line: " << line_str << std::endl; continue; }
+        int player_id_val; // Renamed player_id from original
+        try { player_id_val = std::stoi(tokens[0]); }
+        catch (const std::exception& e) {
+            std::cerr << "Task 4 Warning: Invalid player ID '" << tokens[0] << "' in players CSV. Error: " << e.what() << std::endl;
+            continue;
+        }
+
+        if (!player_index.putIfAbsent(player_id_val, current_player_count)) { // The first row for an ID wins
+            std::cerr << "Task 4 Warning: Duplicate player ID " << player_id_val << " found in players CSV. Skipping." << std::endl;
+            continue;
+        }
+        // PlayerStats: pid, name, rank, contact (email), reg_time (reg type)
+        player_stats[current_player_count] = Task4_PlayerStats(player_id_val, tokens[1], tokens[4], tokens[3], tokens[2]);
+        refreshRank(current_player_count);
+        current_player_count++;
+        loaded_count++;
+    }
+    file.close();
+    std::cout << "Task 4: Loaded " << loaded_count << " players from '" << filename << "'. Total unique players: " << current_player_count << std::endl;
+    return true;
+}
+
+// Loads match history from "matches.csv" (Task 1 format)
+// Fields: match_id,stage,group_id,round,player1_id,player2_id,scheduled_time,status,winner_id,score
+bool Task4_GameResultManager::loadMatchHistory(const std::string& filename) {
+    APUEC_SCOPED_TIMER("Task4 loadMatchHistory");
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Task 4 Warning: Cannot open matches file '" << filename << "' for reading." << std::endl;
+        return false;
+    }
+    std::string line_str; // Renamed line
+    int loaded_count = 0;
+    bool header_skipped = false;
+
+    // Clear existing match data structures for fresh load
+    match_table.clear();
+    while(!recent_matches.isEmpty()) { Task4_MatchResult temp; recent_matches.pop(temp); }
+    next_match_id = 1; // Reset
+
+
+    while (std::getline(file, line_str)) {
+        if (line_str.empty() || line_str.find_first_not_of(" \t\r\n") == std::string::npos) continue;
+        if (!header_skipped) { header_skipped = true; continue; }
+
+        std::string tokens[10];
+        splitCSVLine(line_str, tokens, 10);
+
+        if (tokens[0].empty() || tokens[4].empty() || tokens[5].empty()) {
+            std::cerr << "Task 4 Warning: Missing required fields (match_id, p1_id, p2_id) in match line: " << line_str << std::endl;
+            continue;
+        }
+
+        int match_id_val, group_id_val = 0, round_val = 0, player1_id_val, player2_id_val, winner_id_val = 0;
+        try {
+            match_id_val = std::stoi(tokens[0]);
+            if (!tokens[2].empty()) group_id_val = std::stoi(tokens[2]); else group_id_val = 0; // Group ID can be empty/0 for non-group matches
+            if (!tokens[3].empty()) round_val = std::stoi(tokens[3]); else round_val = 0;
+            player1_id_val = std::stoi(tokens[4]);
+            player2_id_val = std::stoi(tokens[5]);
+            if (!tokens[8].empty() && tokens[8] != "0") winner_id_val = std::stoi(tokens[8]); else winner_id_val = 0; // Winner ID can be empty/0
+
+            if (match_id_val >= next_match_id) next_match_id = match_id_val + 1;
+        } catch (const std::exception& e) {
+            std::cerr << "Task 4 Warning: Invalid numeric data in match line: " << line_str << ". Error: " << e.what() << std::endl;
+            continue;
+        }
+
+        // Ensure players exist in loaded player_stats for stat updates; otherwise, this match might be problematic for stats
+        if (findPlayerIndex(player1_id_val) == -1 && player1_id_val !=0) { std::cout << "Task 4 Info: Player ID " << player1_id_val << " from match " << match_id_val << " not in player list. Stats might be incomplete.\n"; }
+        if (findPlayerIndex(player2_id_val) == -1 && player2_id_val !=0) { std::cout << "Task 4 Info: Player ID " << player2_id_val << " from match " << match_id_val << " not in player list. Stats might be incomplete.\n"; }
+
+
+        if (match_table.append(match_id_val, tokens[1], group_id_val, round_val, player1_id_val,
+                               player2_id_val, tokens[6], tokens[7], winner_id_val, tokens[9]) == -1) {
+            std::cerr << "Task 4 Warning: Skipping match " << match_id_val << ": "
+                      << Task4_MatchTable::rowProblem(round_val, tokens[6], tokens[9]) << "." << std::endl;
+            continue;
+        }
+
+        loaded_count++;
+    }
+    file.close();
+    rebuildPlayerStats(); // Scores were packed to integers by append(); aggregate them in one pass
+    refillRecentMatches();
+    std::cout << "Task 4: Loaded " << loaded_count << " matches from '" << filename << "'. Match table rows: " << match_table.size() << ", Recent stack size: " << recent_matches.size() << std::endl;
+    return true;
+}
+
+
+void Task4_GameResultManager::displayRecentMatches(int count) {
+    std::cout << "\n" << std::string(100, '=') << "\n"
+              << std::string(30, ' ') << "TASK 4: RECENT MATCHES (Last " << std::min(count, recent_matches.size()) << ")\n"
+              << std::string(100, '=') << "\n";
+    if (recent_matches.isEmpty()) {
+        std::cout << "│" << std::left << std::setw(98) << " No recent matches available." << "│\n"
+                  << std::string(100, '=') << "\n"; return;
+    }
+    int display_count = std::min(count, recent_matches.size());
+
+    std::cout << "│" << std::left << std::setw(8) << " Match#" << "│" << std::setw(12) << " Stage" << "│"
+              << std::setw(25) << " Players (P1 vs P2)" << "│" << std::setw(15) << " Winner" << "│"
+              << std::setw(10) << " Score" << "│" << std::setw(12) << " Date" << "│" // Shortened Score width
+              << std::setw(12) << " Status" << "│\n";
+    std::cout << "├" << std::string(8, '-') << "┼" << std::string(12, '-') << "┼" << std::string(25, '-') << "┼"
+              << std::string(15, '-') << "┼" << std::string(10, '-') << "┼" << std::string(12, '-') << "┼"
+              << std::string(12, '-') << "┤\n";
+
+    Task4_Stack tempStack; // To preserve original stack
+    for (int i = 0; i < display_count; i++) {
+        Task4_MatchResult match_res;
+        if (recent_matches.pop(match_res)) { // Pop from original to display in reverse order (most recent first)
+            tempStack.push(match_res); // Store in temp to restore
+
+            int p1_idx = findPlayerIndex(match_res.player1_id);
+            int p2_idx = findPlayerIndex(match_res.player2_id);
+            std::string p1_name = (p1_idx != -1) ? player_stats[p1_idx].name : (match_res.player1_id == 0 ? "N/A" : "ID:" + std::to_string(match_res.player1_id));
+            std::string p2_name = (p2_idx != -1) ? player_stats[p2_idx].name : (match_res.player2_id == 0 ? "N/A" : "ID:" + std::to_string(match_res.player2_id));
+
+            if (p1_name.length() > 9) p1_name = p1_name.substr(0, 8) + ".";
+            if (p2_name.length() > 9) p2_name = p2_name.substr(0, 8) + ".";
+            std::string players_str = p1_name + " vs " + p2_name;
+            if (players_str.length() > 24) players_str = players_str.substr(0, 21) + "...";
+
+            std::string winner_name_str = "None";
+            if (match_res.winner_id != 0) {
+                int winner_idx = findPlayerIndex(match_res.winner_id);
+                winner_name_str = (winner_idx != -1) ? player_stats[winner_idx].name : "ID:" + std::to_string(match_res.winner_id);
+                if (winner_name_str.length() > 13) winner_name_str = winner_name_str.substr(0, 10) + "...";
+            } else if (strcmp(match_res.status.c_str(), "completed")==0) {
+                 winner_name_str = "Draw/TBD";
+            }
+
+
+            std::string date_str = extractDateFromScheduledTime(match_res.scheduled_time);
+            if (date_str.empty() && !match_res.scheduled_time.empty()) date_str = match_res.scheduled_time.substr(0,10); // Fallback
+            else if (date_str.empty()) date_str = "Unknown";
+
+
+            std::cout << "│ " << std::left << std::setw(7) << match_res.match_id << "│ "
+                      << std::setw(11) << (match_res.stage.length() > 10 ? match_res.stage.substr(0,7)+"..." : match_res.stage) << "│ "
+                      << std::setw(24) << players_str << "│ "
+                      << std::setw(14) << winner_name_str << "│ "
+                      << std::setw(9) << (match_res.score.length() > 8 ? match_res.score.substr(0,5)+"..." : match_res.score) << "│ "
+                      << std::setw(11) << date_str << "│ "
+                      << std::setw(11) << (match_res.status.length() > 10 ? match_res.status.substr(0,7)+"..." : match_res.status) << "│\n";
+        } else { break; } // Should not happen if display_count is correct
+    }
+    // Restore original stack
+    Task4_MatchResult match_to_restore_from_temp;
+    while(tempStack.pop(match_to_restore_from_temp)) { // Pop from tempStack
+        recent_matches.push(match_to_restore_from_temp); // Push back to original recent_matches
+    }
+
+    std::cout << std::string(100, '=') << "\n";
+}
+
+void Task4_GameResultManager::displayPlayerStats(int player_id_val) { // Renamed player_id
+    int index = findPlayerIndex(player_id_val);
+    if (index == -1) {
+        std::cout << "\nTask 4: Player ID " << player_id_val << " not found in statistics.\n"; return;
+    }
+    const Task4_PlayerStats& ps = player_stats[index]; // Renamed player_stat to ps
+    std::cout << "\n+----------------------------------------+\n"
+              << "|   TASK 4: PLAYER STATISTICS FOR ID " << std::setw(4) << ps.player_id << "   |\n"
+              << "+----------------------------------------+\n"
+              << "| Name: " << std::left << std::setw(30) << (ps.name.length()>28?ps.name.substr(0,25)+"...":ps.name) << "|\n"
+              << "| Rank: " << std::left << std::setw(30) << (ps.rank.length()>28?ps.rank.substr(0,25)+"...":ps.rank) << "|\n"
+              << "| Email: " << std::left << std::setw(29) << (ps.contact.length()>27?ps.contact.substr(0,24)+"...":ps.contact) << "|\n" // Contact is Email
+              << "| Reg. Type: " << std::left << std::setw(25) << (ps.registration_time.length()>23?ps.registration_time.substr(0,20)+"...":ps.registration_time) << "|\n" // Reg. Time is Reg Type
+              << "|----------------------------------------|\n"
+              << "| Total Matches: " << std::left << std::setw(21) << ps.total_matches << "|\n"
+              << "| Wins:          " << std::left << std::setw(21) << ps.wins << "|\n"
+              << "| Losses:        " << std::left << std::setw(21) << ps.losses << "|\n";
+    if (ps.total_matches > 0) {
+        double win_rate = (static_cast<double>(ps.wins) / ps.total_matches) * 100.0;
+        std::cout << "| Win Rate:      " << std::fixed << std::setprecision(1) << std::setw(19) << win_rate << "% |\n";
+    } else { std::cout << "| Win Rate:      " << std::left << std::setw(20) << "N/A" << "|\n"; }
+    std::cout << "| Average Score: " << std::fixed << std::setprecision(2) << std::setw(19) << ps.averageScore() << " |\n";
+    std::ostringstream oss_standing; oss_standing << "#" << leaderboard.rankOf(index) << " of " << leaderboard.size();
+    std::cout << "| Leaderboard:   " << std::left << std::setw(21) << oss_standing.str() << "|\n"
+              << "+----------------------------------------+\n";
+}
+
+int Task4_GameResultManager::playerRank(int player_id_val) const {
+    int index;
+    return player_index.find(player_id_val, index) ? leaderboard.rankOf(index) : -1;
+}
+
+void Task4_GameResultManager::displayHeadToHead(int player_a, int player_b) {
+    int index_a = findPlayerIndex(player_a), index_b = findPlayerIndex(player_b);
+    std::string name_a = index_a != -1 ? player_stats[index_a].name : "Unknown";
+    std::string name_b = index_b != -1 ? player_stats[index_b].name : "Unknown";
+    std::cout << "\nTASK 4: HEAD-TO-HEAD " << player_a << " (" << name_a << ") vs " << player_b << " (" << name_b << ")\n";
+    const Task4_HeadToHeadRecord* r = head_to_head.find(player_a, player_b);
+    if (!r || r->matches <= 0) { std::cout << "These players have no completed matches against each other.\n"; return; }
+    int wins_a = r->low_id == player_a ? r->low_wins : r->high_wins;
+    int wins_b = r->low_id == player_a ? r->high_wins : r->low_wins;
+    std::cout << "Meetings: " << r->matches << " | " << name_a << ": " << wins_a << " wins | " << name_b << ": " << wins_b << " wins\n";
+    if (r->last_row != -1) {
+        std::cout << "Last meeting: Match " << match_table.matchId(r->last_row) << " (" << match_table.stageName(r->last_row)
+                  << ", " << match_table.scheduledDate(r->last_row) << ")";
+        std::string score = match_table.scoreText(r->last_row);
+        if (!score.empty()) std::cout << " score " << score;
+        std::cout << "\n";
+    }
+}
+
+void Task4_GameResultManager::displayTopRivals(int player_id_val, int count) {
+    int index = findPlayerIndex(player_id_val);
+    if (index == -1) { std::cout << "\nTask 4: Player ID " << player_id_val << " not found.\n"; return; }
+    if (count <= 0) count = 5;
+    const Task4_HeadToHeadRecord** top = new const Task4_HeadToHeadRecord*[count];
+    int found = head_to_head.topRivals(player_id_val, count, top);
+    std::cout << "\nTASK 4: TOP RIVALS OF " << player_id_val << " (" << player_stats[index].name << ")\n";
+    if (found == 0) { std::cout << "No completed matches against other players.\n"; delete[] top; return; }
+    std::cout << "+------+--------------------+----------+------+--------+\n"
+              << "| ID   | Opponent           | Meetings | Wins | Losses |\n"
+              << "+------+--------------------+----------+------+--------+\n";
+    for (int i = 0; i < found; i++) {
+        const Task4_HeadToHeadRecord* r = top[i];
+        int opponent = r->low_id == player_id_val ? r->high_id : r->low_id;
+        int wins = r->low_id == player_id_val ? r->low_wins : r->high_wins;
+        int opponent_index = findPlayerIndex(opponent);
+        std::string name = opponent_index != -1 ? player_stats[opponent_index].name : "Unknown";
+        std::cout << "| " << std::left << std::setw(4) << opponent << " | "
+                  << std::setw(18) << (name.length()>17?name.substr(0,14)+"...":name) << " | "
+                  << std::right << std::setw(8) << r->matches << " | "
+                  << std::setw(4) << wins << " | "
+                  << std::setw(6) << (r->matches - wins) << " |\n";
+    }
+    std::cout << "+------+--------------------+----------+------+--------+\n";
+    delete[] top;
+}
+
+void Task4_GameResultManager::displayPlayerForm(int player_id_val) {
+    int index = findPlayerIndex(player_id_val);
+    if (index == -1) { std::cout << "\nTask 4: Player ID " << player_id_val << " not found.\n"; return; }
+    int window = rolling_form.windowDays();
+    int last_day = rolling_form.lastDay();
+    std::cout << "\nTASK 4: FORM OVER THE LAST " << window << " DAYS FOR PLAYER " << player_id_val
+              << " (" << player_stats[index].name << ")\n";
+    if (last_day == -1) { std::cout << "No dated results logged yet.\n"; return; }
+    int matches, wins;
+    rolling_form.summary(index, matches, wins);
+    std::cout << "Window: " << Task4_MatchTable::formatEpoch((long long)(last_day - window + 1) * 86400, false)
+              << " to " << Task4_MatchTable::formatEpoch((long long)last_day * 86400, false) << "\n";
+    if (matches == 0) { std::cout << "No completed matches in this window.\n"; return; }
+    std::cout << "Matches: " << matches << " | Wins: " << wins << " | Losses: " << (matches - wins)
+              << " | Win Rate: " << std::fixed << std::setprecision(1) << (100.0 * wins / matches) << "%\n";
+
+    Task4_DayRecord* days = new Task4_DayRecord[match_table.dayBlockCount()];
+    int found = match_table.playerRecordByDay(player_id_val, (long long)(last_day - window + 1) * 86400,
+                                              (long long)last_day * 86400 + 86399, days);
+    for (int i = 0; i < found; i++) {
+        std::cout << "  " << Task4_MatchTable::formatEpoch((long long)days[i].day * 86400, false) << ": "
+                  << days[i].wins << "-" << (days[i].matches - days[i].wins) << "\n";
+    }
+    delete[] days;
+}
+
+void Task4_GameResultManager::displayWinRateByDay(int player_id_val) {
+    int index = findPlayerIndex(player_id_val);
+    if (index == -1) { std::cout << "\nTask 4: Player ID " << player_id_val << " not found.\n"; return; }
+    std::cout << "\nTASK 4: WIN RATE BY TOURNAMENT DAY FOR PLAYER " << player_id_val << " (" << player_stats[index].name << ")\n";
+    Task4_DayRecord* days = new Task4_DayRecord[match_table.dayBlockCount()];
+    int found = match_table.playerRecordByDay(player_id_val, 0, std::numeric_limits<long long>::max(), days);
+    if (found == 0) { std::cout << "No completed matches with a known date.\n"; delete[] days; return; }
+    std::cout << "+-------+------------+---------+------+--------+-----------+\n"
+              << "| Day   | Date       | Matches | Wins | Losses | Win Rate  |\n"
+              << "+-------+------------+---------+------+--------+-----------+\n";
+    for (int i = 0; i < found; i++) {
+        std::ostringstream oss_wr; oss_wr << std::fixed << std::setprecision(1) << (100.0 * days[i].wins / days[i].matches) << "%";
+        std::cout << "| " << std::left << std::setw(5) << (days[i].block + 1) << " | "
+                  << Task4_MatchTable::formatEpoch((long long)days[i].day * 86400, false) << " | "
+                  << std::right << std::setw(7) << days[i].matches << " | "
+                  << std::setw(4) << days[i].wins << " | "
+                  << std::setw(6) << (days[i].matches - days[i].wins) << " | "
+                  << std::setw(9) << oss_wr.str() << " |\n";
+    }
+    std::cout << "+-------+------------+---------+------+--------+-----------+\n";
+    delete[] days;
+}
+
+// Writes an N x N "wins-losses" grid for the top N leaderboard seeds, read from the row player's side.
+bool Task4_GameResultManager::exportHeadToHeadMatrix(int top_n, const std::string& filename) {
+    if (top_n <= 0) return false;
+    int* seeds = new int[top_n];
+    int seed_count = leaderboard.range(1, top_n, seeds);
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Task 4 Warning: Cannot open '" << filename << "' for writing." << std::endl;
+        delete[] seeds;
+        return false;
+    }
+    file << "player_id";
+    for (int j = 0; j < seed_count; j++) file << "," << player_stats[seeds[j]].player_id;
+    file << "\n";
+    for (int i = 0; i < seed_count; i++) {
+        int row_id = player_stats[seeds[i]].player_id;
+        file << row_id;
+        for (int j = 0; j < seed_count; j++) {
+            int col_id = player_stats[seeds[j]].player_id;
+            const Task4_HeadToHeadRecord* r = i == j ? nullptr : head_to_head.find(row_id, col_id);
+            file << ",";
+            if (r && r->matches > 0) {
+                int wins = r->low_id == row_id ? r->low_wins : r->high_wins;
+                file << wins << "-" << (r->matches - wins);
+            }
+        }
+        file << "\n";
+    }
+    file.close();
+    std::cout << "Task 4: Head-to-head matrix for the top " << seed_count << " players written to '" << filename << "'.\n";
+    delete[] seeds;
+    return true;
+}
+
+// Prints leaderboard positions first_rank..last_rank; only the requested slice of the tree is visited.
+void Task4_GameResultManager::displayLeaderboard(int first_rank, int last_rank) {
+    int ranked = leaderboard.size();
+    if (first_rank < 1) first_rank = 1;
+    if (last_rank > ranked) last_rank = ranked;
+    std::cout << "\nTASK 4: LEADERBOARD (Ranks " << first_rank << "-" << last_rank << " of " << ranked << ")\n";
+    if (first_rank > last_rank) { std::cout << "No players ranked in that range.\n"; return; }
+    int* slots = new int[last_rank - first_rank + 1];
+    int found = leaderboard.range(first_rank, last_rank, slots);
+    std::cout << "+------+-----+--------------------+---------+------+--------+-----------+-----------+\n"
+              << "| Rank | ID  | Name               | Matches | Wins | Losses | Win Rate  | Avg Score |\n"
+              << "+------+-----+--------------------+---------+------+--------+-----------+-----------+\n";
+    for (int i = 0; i < found; i++) {
+        const Task4_PlayerStats& ps = player_stats[slots[i]];
+        std::string win_rate_str = "N/A";
+        if (ps.total_matches > 0) {
+            std::ostringstream oss_wr; oss_wr << std::fixed << std::setprecision(1)
+                                              << (static_cast<double>(ps.wins) / ps.total_matches) * 100.0 << "%";
+            win_rate_str = oss_wr.str();
+        }
+        std::ostringstream oss_as; oss_as << std::fixed << std::setprecision(2) << ps.averageScore();
+        std::cout << "| " << std::right << std::setw(4) << (first_rank + i) << " | "
+                  << std::left << std::setw(3) << ps.player_id << " | "
+                  << std::setw(18) << (ps.name.length()>17?ps.name.substr(0,14)+"...":ps.name) << " | "
+                  << std::right << std::setw(7) << ps.total_matches << " | "
+                  << std::setw(4) << ps.wins << " | "
+                  << std::setw(6) << ps.losses << " | "
+                  << std::setw(9) << win_rate_str << " | "
+                  << std::setw(9) << oss_as.str() << " |\n";
+    }
+    std::cout << "+------+-----+--------------------+---------+------+--------+-----------+-----------+\n";
+    delete[] slots;
+}
+
+void Task4_GameResultManager::displayAllPlayerStats() {
+    std::cout << "\nTASK 4: ALL PLAYER STATISTICS (" << current_player_count << " players)\n";
+    if (current_player_count == 0) { std::cout << "No player statistics loaded or available.\n"; return; }
+    std::cout << "+-----+--------------------+----------+---------+------+--------+-----------+-----------+\n"
+              << "| ID  | Name               | Rank     | Matches | Wins | Losses | Win Rate  | Avg Score |\n"
+              << "+-----+--------------------+----------+---------+------+--------+-----------+-----------+\n";
+    for (int i = 0; i < current_player_count; i++) {
+        const Task4_PlayerStats& ps = player_stats[i];
+        std::string win_rate_str = "N/A";
+        if (ps.total_matches > 0) {
+            double wr_val = (static_cast<double>(ps.wins) / ps.total_matches) * 100.0; // Renamed wr
+            std::ostringstream oss_wr; oss_wr << std::fixed << std::setprecision(1) << wr_val << "%";
+            win_rate_str = oss_wr.str();
+        }
+        std::ostringstream oss_as; oss_as << std::fixed << std::setprecision(2) << ps.averageScore(); // Renamed avg_score_oss
+
+        std::cout << "| " << std::left << std::setw(3) << ps.player_id << " | "
+                  << std::setw(18) << (ps.name.length()>17?ps.name.substr(0,14)+"...":ps.name) << " | "
+                  << std::setw(8) << (ps.rank.length()>7?ps.rank.substr(0,4)+"...":ps.rank) << " | "
+                  << std::right << std::setw(7) << ps.total_matches << " | "
+                  << std::setw(4) << ps.wins << " | "
+                  << std::setw(6) << ps.losses << " | "
+                  << std::setw(9) << win_rate_str << " | "
+                  << std::setw(9) << oss_as.str() << " |\n";
+    }
+    std::cout << "+-----+--------------------+----------+---------+------+--------+-----------+-----------+\n";
+}
+
+void Task4_GameResultManager::queryMatchesByPlayer(int player_id_val) { // Renamed player_id
+    int player_idx = findPlayerIndex(player_id_val);
+    if (player_idx == -1) { std::cout << "\nTask 4: Player ID " << player_id_val << " not found.\n"; return; }
+
+    std::cout << "\nTASK 4: MATCH HISTORY FOR PLAYER " << player_id_val << " (" << player_stats[player_idx].name << ")\n";
+    bool found_any = false; // Renamed found_any_matches
+
+    std::cout << "+---------+--------------------+----------+--------+---------+------------+-------+\n"
+              << "| MatchID | Opponent           | Stage    | Result | Score   | Date       | Round |\n"
+              << "+---------+--------------------+----------+--------+---------+------------+-------+\n";
+
+    int matches_processed = 0;
+    // The player's posting list names their rows directly, so this is O(k) in their match count.
+    const int* player_rows;
+    int player_row_count = match_table.rowsForPlayer(player_id_val, player_rows);
+    for (int r = 0; r < player_row_count; r++) {
+        int row = player_rows[r];
+        found_any = true;
+        matches_processed++;
+        int p1_id = match_table.player1Id(row);
+        int opp_id_val = (p1_id == player_id_val) ? match_table.player2Id(row) : p1_id; // Renamed opponent_id_val
+        int opp_idx = findPlayerIndex(opp_id_val); // Renamed opponent_idx
+        std::string opp_name_str = (opp_idx != -1) ? player_stats[opp_idx].name : (opp_id_val == 0 ? "N/A" : "ID:" + std::to_string(opp_id_val)); // Renamed opponent_name_str
+        if(opp_name_str.length() > 18) opp_name_str = opp_name_str.substr(0,15) + "...";
+
+        std::string res_str = "Pending"; // Renamed result_str
+        int winner_val = match_table.winnerId(row);
+        if(match_table.isCompleted(row)) {
+            if (winner_val == player_id_val) res_str = "WIN";
+            else if (winner_val != 0 && winner_val != player_id_val) res_str = "LOSS";
+            else res_str = "DRAW/TBD";
+        }
+
+        std::string date_val = match_table.scheduledDate(row);
+        if(date_val.empty()) date_val = "Unknown";
+        const std::string& stage_val = match_table.stageName(row);
+        std::string score_val = match_table.scoreText(row);
+
+        std::cout << "| " << std::left << std::setw(7) << match_table.matchId(row) << " | "
+                  << std::setw(18) << opp_name_str << " | "
+                  << std::setw(8) << (stage_val.length()>7?stage_val.substr(0,4)+"...":stage_val) << " | "
+                  << std::setw(6) << res_str << " | "
+                  << std::setw(7) << (score_val.length()>6?score_val.substr(0,3)+"...":score_val) << " | "
+                  << std::setw(10) << date_val << " | "
+                  << std::right << std::setw(5) << match_table.round(row) << " |\n";
+    }
+
+    if (!found_any) { std::cout << "| No matches found for this player.                                                    |\n"; }
+    else { std::cout << "| Total matches involving player: " << std::left << std::setw(50) << matches_processed << "|\n"; }
+    std::cout << "+---------+--------------------+----------+--------+---------+------------+-------+\n";
+}
+
+void Task4_GameResultManager::queryMatchesByStage(const std::string& stage_query) {
+    std::cout << "\nTASK 4: MATCHES IN STAGE: '" << stage_query << "'\n";
+    Task4_MatchFilter filter;
+    filter.stage = stage_query;
+    Task4_Bitmap rows;
+    int matches_in_stage = queryMatches(filter, rows); // Stage bitmap, no row scan
+
+    printMatchRows(rows);
+    if (matches_in_stage == 0) { std::cout << "| No matches found for this stage.                                                     |\n"; }
+    else { std::cout << "| Total matches in stage '" << stage_query << "': " << std::left << std::setw(40) << matches_in_stage << "|\n"; }
+    std::cout << "+---------+-------------------------+------------------+---------+-------+------------+\n";
+}
+
+int Task4_GameResultManager::queryMatches(const Task4_MatchFilter& filter, Task4_Bitmap& rows) const {
+    return match_table.select(filter, rows);
+}
+
+void Task4_GameResultManager::displayFilteredMatches(const Task4_MatchFilter& filter) {
+    std::cout << "\nTASK 4: MATCHES WHERE"
+              << " stage=" << (filter.stage.empty() ? "any" : filter.stage)
+              << " status=" << (filter.status.empty() ? "any" : filter.status)
+              << " round=" << (filter.round < 0 ? std::string("any") : std::to_string(filter.round))
+              << " group=" << (filter.group_id < 0 ? std::string("any") : std::to_string(filter.group_id))
+              << " date=" << (filter.date_from.empty() ? "..." : filter.date_from)
+              << " to " << (filter.date_to.empty() ? "..." : filter.date_to) << "\n";
+    Task4_Bitmap rows;
+    int matched = queryMatches(filter, rows);
+
+    printMatchRows(rows);
+    if (matched == 0) { std::cout << "| No matches found for this filter.                                                    |\n"; }
+    else { std::cout << "| Total matches: " << std::left << std::setw(71) << matched << "|\n"; }
+    std::cout << "+---------+-------------------------+------------------+---------+-------+------------+\n";
+}
+
+// Prints the header and one line per row; the caller prints the totals line.
+void Task4_GameResultManager::printMatchRows(const Task4_Bitmap& rows) {
+    std::cout << "+---------+-------------------------+------------------+---------+-------+------------+\n"
+              << "| MatchID | Players (P1 vs P2)      | Winner           | Score   | Round | Date       |\n"
+              << "+---------+-------------------------+------------------+---------+-------+------------+\n";
+
+    for (int row = rows.nextRow(0); row != -1; row = rows.nextRow(row + 1)) {
+        int p1_rec_id = match_table.player1Id(row);
+        int p2_rec_id = match_table.player2Id(row);
+        int p1_rec_idx = findPlayerIndex(p1_rec_id);
+        int p2_rec_idx = findPlayerIndex(p2_rec_id);
+        std::string p1_rec_name = (p1_rec_idx != -1) ? player_stats[p1_rec_idx].name : (p1_rec_id == 0 ? "N/A" : "ID:" + std::to_string(p1_rec_id));
+        std::string p2_rec_name = (p2_rec_idx != -1) ? player_stats[p2_rec_idx].name : (p2_rec_id == 0 ? "N/A" : "ID:" + std::to_string(p2_rec_id));
+        if(p1_rec_name.length()>9) p1_rec_name = p1_rec_name.substr(0,8)+".";
+        if(p2_rec_name.length()>9) p2_rec_name = p2_rec_name.substr(0,8)+".";
+        std::string players_rec_str = p1_rec_name + " vs " + p2_rec_name;
+        if(players_rec_str.length() > 23) players_rec_str = players_rec_str.substr(0,20)+"...";
+
+        std::string winner_rec_name = "None";
+        int winner_rec_id = match_table.winnerId(row);
+        if (winner_rec_id != 0) {
+            int winner_rec_idx = findPlayerIndex(winner_rec_id);
+            winner_rec_name = (winner_rec_idx != -1) ? player_stats[winner_rec_idx].name : "ID:" + std::to_string(winner_rec_id);
+            if(winner_rec_name.length() > 16) winner_rec_name = winner_rec_name.substr(0,13)+"...";
+        } else if (match_table.isCompleted(row)) {
+             winner_rec_name = "Draw/TBD";
+        }
+
+        std::string date_rec_val = match_table.scheduledDate(row);
+        if (date_rec_val.empty()) date_rec_val = "Unknown";
+        std::string score_rec_val = match_table.scoreText(row);
+
+        std::cout << "| " << std::left << std::setw(7) << match_table.matchId(row) << " | "
+                  << std::setw(23) << players_rec_str << " | "
+                  << std::setw(16) << winner_rec_name << " | "
+                  << std::setw(7) << (score_rec_val.length()>6?score_rec_val.substr(0,3)+"...":score_rec_val) << " | "
+                  << std::right << std::setw(5) << match_table.round(row) << " | "
+                  << std::left << std::setw(10) << date_rec_val << " |\n";
+    }
+}
+
+
+void Task4_GameResultManager::displayMenu_Task4() {
+    std::cout << "\n\n+----------------------------------------------------+\n"
+              << "| APUEC: RESULT LOGGING & PERFORMANCE HISTORY (TASK 4) |\n"
+              << "+----------------------------------------------------+\n"
+              << "| 1. Display Recent Matches (Last 5)                 |\n"
+              << "| 2. Display All Player Statistics                   |\n"
+              << "| 3. Display Specific Player Statistics              |\n"
+              << "| 4. Query Matches by Player ID                      |\n"
+              << "| 5. Query Matches by Stage Name                     |\n"
+              << "| 6. Filter Matches (Stage/Round/Group/Status/Date)  |\n"
+              << "| 7. Reload Data from CSV Files                      |\n"
+              << "| 8. Leaderboard (Top-K or Rank Range)               |\n"
+              << "| 9. Head-to-Head Record (Two Players)               |\n"
+              << "| 10. Top Rivals of a Player                         |\n"
+              << "| 11. Export Head-to-Head Matrix (Top N Seeds)       |\n"
+              << "| 12. Player Form (Last 7 Days)                      |\n"
+              << "| 13. Player Win Rate by Tournament Day              |\n"
+              << "| 14. Save New Matches as a Season (Binary Archive)  |\n"
+              << "| 15. Load All Seasons from the Binary Archive       |\n"
+              << "| 16. Export Matches & Stats (CSV/JSONL/Columnar)    |\n"
+              << "| 0. Return to Main APUEC Menu                       |\n"
+              << "+----------------------------------------------------+\n"
+              << "Enter your choice (Task 4): ";
+}
+
+// The CSVs are only read on the first visit. After that the manager stays resident and
+// Task 1 results arrive through recordMatchResult (see onMatchCompleted); option 7 forces a reload.
+void Task4_GameResultManager::ensureDataLoaded() {
+    if (!data_loaded) {
+        std::cout << "Task 4: Loading player data (from 'Player_Registration.csv')...\n";
+        loadPlayerData("Player_Registration.csv"); // Using the same CSV as Task 1 and Task 2
+        std::cout << "Task 4: Loading match history (from 'matches.csv')...\n";
+        loadMatchHistory("matches.csv"); // This is generated by Task 1
+        data_loaded = true;
+    } else {
+        std::cout << "Task 4: Using resident data (" << match_table.size() << " matches, " << current_player_count << " players).\n";
+    }
+}
+
+const Task4_PlayerStats* Task4_GameResultManager::getPlayerStats(int player_id_val) const {
+    int index;
+    return player_index.find(player_id_val, index) ? &player_stats[index] : nullptr;
+}
+
+void Task4_GameResultManager::runProgram() {
+    std::cout << "\n=== Task 4: Game Result System Initializing ===\n";
+    ensureDataLoaded();
+    std::cout << "Task 4 System ready!\n";
+
+    int choice_task4; bool exit_task4_cli = false;
+    while (!exit_task4_cli) {
+        displayMenu_Task4();
+        // Using std::cin for Task 4, consistent with original task4 code.
+        if (!(std::cin >> choice_task4) && std::cin.eof()) {
+            choice_task4 = 0; // Input has ended: leave, as the main and Task 3 menus do
+        } else if (std::cin.fail()) {
+            std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Invalid input (Task 4). Please enter a number.\n"; choice_task4 = -1; // sentinel
+        } else { std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); } // Consume newline
+
+        switch (choice_task4) {
+            case 1: displayRecentMatches(5); break;
+            case 2: displayAllPlayerStats(); break;
+            case 3: {
+                std::cout << "Enter Player ID to display stats (Task 4): "; int pid_stat;
+                if (std::cin >> pid_stat) {
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    displayPlayerStats(pid_stat);
+                } else {
+                    std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::cout << "Invalid Player ID format entered.\n";
+                }
+                break;
+            }
+            case 4: {
+                std::cout << "Enter Player ID to query matches (Task 4): "; int pid_query;
+                if (std::cin >> pid_query) {
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    queryMatchesByPlayer(pid_query);
+                } else {
+                    std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::cout << "Invalid Player ID format entered.\n";
+                }
+                break;
+            }
+            case 5: {
+                std::cout << "Enter stage name to query (e.g., group, knockout) (Task 4): "; std::string stage_name_q;
+                std::getline(std::cin, stage_name_q); // Use getline for stage name with potential spaces
+                queryMatchesByStage(stage_name_q);
+                break;
+            }
+            case 6: {
+                Task4_MatchFilter filter;
+                std::string field;
+                std::cout << "Press Enter to skip a field.\n";
+                std::cout << "Stage (e.g., group, knockout): "; std::getline(std::cin, filter.stage);
+                std::cout << "Status (e.g., completed, scheduled): "; std::getline(std::cin, filter.status);
+                std::cout << "Round: "; std::getline(std::cin, field);
+                if (!field.empty()) filter.round = atoi(field.c_str());
+                std::cout << "Group ID: "; std::getline(std::cin, field);
+                if (!field.empty()) filter.group_id = atoi(field.c_str());
+                std::cout << "From date (YYYY-MM-DD): "; std::getline(std::cin, filter.date_from);
+                std::cout << "To date (YYYY-MM-DD): "; std::getline(std::cin, filter.date_to);
+                displayFilteredMatches(filter);
+                break;
+            }
+            case 7:
+                loadPlayerData("Player_Registration.csv");
+                loadMatchHistory("matches.csv");
+                break;
+            case 8: {
+                std::string field;
+                int first_rank = 1, last_rank = 10;
+                std::cout << "First rank (Enter for 1): "; std::getline(std::cin, field);
+                if (!field.empty()) first_rank = atoi(field.c_str());
+                std::cout << "Last rank (Enter for " << first_rank + 9 << "): "; std::getline(std::cin, field);
+                last_rank = field.empty() ? first_rank + 9 : atoi(field.c_str());
+                displayLeaderboard(first_rank, last_rank);
+                break;
+            }
+            case 9: {
+                int pid_a, pid_b;
+                std::cout << "Enter the two Player IDs (Task 4): ";
+                if (std::cin >> pid_a >> pid_b) {
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    displayHeadToHead(pid_a, pid_b);
+                } else {
+                    std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::cout << "Invalid Player ID format entered.\n";
+                }
+                break;
+            }
+            case 10: {
+                std::cout << "Enter Player ID to list rivals (Task 4): "; int pid_rivals;
+                if (std::cin >> pid_rivals) {
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    displayTopRivals(pid_rivals, 5);
+                } else {
+                    std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::cout << "Invalid Player ID format entered.\n";
+                }
+                break;
+            }
+            case 11: {
+                std::string field;
+                std::cout << "Number of top seeds (Enter for 8): "; std::getline(std::cin, field);
+                int top_n = field.empty() ? 8 : atoi(field.c_str());
+                exportHeadToHeadMatrix(top_n, "head_to_head.csv");
+                break;
+            }
+            case 12:
+            case 13: {
+                std::cout << "Enter Player ID (Task 4): "; int pid_days;
+                if (std::cin >> pid_days) {
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    if (choice_task4 == 12) displayPlayerForm(pid_days);
+                    else displayWinRateByDay(pid_days);
+                } else {
+                    std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::cout << "Invalid Player ID format entered.\n";
+                }
+                break;
+            }
+            case 14: saveSeasonSnapshot("matches_archive.bin"); break;
+            case 15: loadSnapshot("matches_archive.bin"); break;
+            case 16: {
+                std::string field;
+                std::cout << "Format - 1. CSV  2. JSON Lines  3. Columnar (matches only) (Enter for 1): ";
+                std::getline(std::cin, field);
+                int format_choice = field.empty() ? 1 : atoi(field.c_str());
+                if (format_choice == 2) {
+                    exportMatches("matches_export.jsonl", TASK4_EXPORT_JSONL);
+                    exportPlayerStats("player_stats_export.jsonl", TASK4_EXPORT_JSONL);
+                } else if (format_choice == 3) {
+                    exportMatches("matches_export.col", TASK4_EXPORT_COLUMNAR);
+                } else {
+                    exportMatches("matches_export.csv", TASK4_EXPORT_CSV);
+                    exportPlayerStats("player_stats_export.csv", TASK4_EXPORT_CSV);
+                }
+                break;
+            }
+            case 0: exit_task4_cli = true; std::cout << "Returning to main APUEC menu from Task 4.\n"; break;
+            default: if (choice_task4 != -1) std::cout << "Invalid choice (Task 4). Please try again.\n"; break;
+        }
+        if (!exit_task4_cli && choice_task4 != -1 && choice_task4 !=0) { // Don't pause if invalid input or exiting
+            std::cout << "\n(Task 4: Press Enter to return to Task 4 menu...)";
+            // std::cin.get(); // Already handled by cin.ignore after successful numeric input
+            // For getline cases, or if just pressing enter is desired.
+            // To be safe, a specific getchar() or cin.get() might be needed if the loop feels too fast.
+        }
+    }
+     std::cout << "--- Task 4: Game Result System Closed ---\n";
+}
+
+// Helper to extract YYYY-MM-DD from "YYYY-MM-DD HH:MM..."
+std::string Task4_GameResultManager::extractDateFromScheduledTime(const std::string& scheduled_time_str) {
+    if (scheduled_time_str.length() >= 10) {
+        // Basic check for YYYY-MM-DD format
+        if (scheduled_time_str[4] == '-' && scheduled_time_str[7] == '-') {
+            // Further validation could be added (e.g., are parts numeric?)
+            try {
+                int y = std::stoi(scheduled_time_str.substr(0, 4));
+                int m = std::stoi(scheduled_time_str.substr(5, 2));
+                int d = std::stoi(scheduled_time_str.substr(8, 2));
+                if (y >= 1000 && y <= 9999 && m >= 1 && m <= 12 && d >= 1 && d <= 31) { // Basic sanity check
+                    return scheduled_time_str.substr(0, 10);
+                }
+            } catch (const std::exception&) {
+                return ""; // Conversion failed
+            }
+        }
+    }
+    return ""; // Return empty if not valid or long enough
+}
+
+// Splits a CSV line into tokens. Handles basic CSV, not quoted fields with commas.
+void Task4_GameResultManager::splitCSVLine(const std::string& line_to_split, std::string tokens_array[], int max_tokens) { // Renamed line
+    std::istringstream stream(line_to_split);
+    std::string token;
+    int count = 0;
+    while (std::getline(stream, token, ',') && count < max_tokens) {
+        // Trim whitespace from token
+        size_t startpos = token.find_first_not_of(" \t\r\n");
+        size_t endpos = token.find_last_not_of(" \t\r\n");
+        if (std::string::npos == startpos) { // Token is all whitespace
+            tokens_array[count++] = "";
+        } else {
+            tokens_array[count++] = token.substr(startpos, endpos - startpos + 1);
+        }
+    }
+    // Fill remaining token slots with empty strings if line had fewer tokens
+    while (count < max_tokens) {
+        tokens_array[count++] = "";
+    }
+}
+
+// Finds index of player_id in player_stats array. Returns -1 if not found.
+int Task4_GameResultManager::findPlayerIndex(int player_id_to_find) { // Renamed player_id
+    int index;
+    return player_index.find(player_id_to_find, index) ? index : -1;
+}
+
+// Updates player's statistics after a single match; direction -1 takes a result back out.
+void Task4_GameResultManager::updatePlayerStats(int player_id_to_update, bool is_winner_flag, int score_achieved, int direction) { // Renamed player_id, is_winner, score_val
+    int index = findPlayerIndex(player_id_to_update);
+    if (index == -1) {
+        // std::cout << "Task 4 Info: Player ID " << player_id_to_update << " not found for stat update. Perhaps add them or check CSVs.\n";
+        return; // Player not found, cannot update stats
+    }
+    Task4_PlayerStats& ps_ref = player_stats[index]; // Renamed player_stat_ref to ps_ref
+    ps_ref.total_matches += direction;
+    if (is_winner_flag) {
+        ps_ref.wins += direction;
+    } else {
+        ps_ref.losses += direction;
+    }
+    ps_ref.score_total += direction * score_achieved; // The average is derived at display time
+    refreshRank(index);
+}
+
+void Task4_GameResultManager::refreshRank(int index) {
+    const Task4_PlayerStats& ps = player_stats[index];
+    leaderboard.update(index, ps.player_id, ps.total_matches, ps.wins, ps.score_total);
+}
+
+// Adds (direction 1) or removes (direction -1) one row's contribution to both players' stats.
+void Task4_GameResultManager::applyRowToStats(int row, int direction) {
+    int winner = match_table.winnerId(row);
+    if (!match_table.isCompleted(row) || winner == 0) return; // Same rule as aggregatePlayerTotals
+    int p1 = match_table.player1Id(row);
+    int p2 = match_table.player2Id(row);
+    updatePlayerStats(p1, winner == p1, match_table.score1(row), direction);
+    if (p2 != p1) updatePlayerStats(p2, winner == p2, match_table.score2(row), direction);
+    head_to_head.applyRow(match_table, row, direction);
+    applyRowToForm(row, direction);
+}
+
+void Task4_GameResultManager::applyRowToForm(int row, int direction) {
+    long long scheduled = match_table.scheduledAt(row);
+    int winner = match_table.winnerId(row);
+    if (scheduled < 0 || !match_table.isCompleted(row) || winner == 0) return;
+    int day = (int)(scheduled / 86400);
+    int p1 = match_table.player1Id(row);
+    int p2 = match_table.player2Id(row);
+    rolling_form.apply(findPlayerIndex(p1), day, winner == p1, direction);
+    if (p2 != p1) rolling_form.apply(findPlayerIndex(p2), day, winner == p2, direction);
+}
+
+void Task4_GameResultManager::recordMatchResult(const Task4_MatchResult& result) {
+    APUEC_SCOPED_TIMER("Task4 recordMatchResult");
+    if (!data_loaded) return; // Not loaded yet: the first load reads this result from matches.csv
+    int row = match_table.findRow(result.match_id);
+    const char* problem = Task4_MatchTable::rowProblem(result.round, result.scheduled_time, result.score);
+    if (problem) {
+        std::cerr << "Task 4 Warning: Result for match " << result.match_id << " not recorded: " << problem << "." << std::endl;
+        return;
+    }
+    if (row == -1) {
+        row = match_table.append(result.match_id, result.stage, result.group_id, result.round, result.player1_id,
+                                 result.player2_id, result.scheduled_time, result.status, result.winner_id, result.score);
+    } else { // A scheduled match we already hold: swap its old contribution for the new one
+        applyRowToStats(row, -1);
+        match_table.updateResult(row, result.player1_id, result.player2_id, result.status, result.winner_id, result.score);
+    }
+    applyRowToStats(row, 1);
+    if (rolling_form.needsRebuild()) rebuildRollingForm(); // The result moved off the latest day
+    if (!recent_matches.replace(result)) recent_matches.pushEvictOldest(result); // One history entry per match
+    if (result.match_id >= next_match_id) next_match_id = result.match_id + 1;
+}
+
+void Task4_GameResultManager::onMatchCompleted(const Match* match, void* context) {
+    Task4_GameResultManager* manager = static_cast<Task4_GameResultManager*>(context);
+    if (!manager || !match) return;
+    Task4_MatchResult result(match->getId(), match->getStage(), match->getGroupId(), match->getRound(),
+                             match->getPlayer1() ? match->getPlayer1()->getId() : 0,
+                             match->getPlayer2() ? match->getPlayer2()->getId() : 0,
+                             match->getScheduledTime(), match->getStatus(),
+                             match->getWinner() ? match->getWinner()->getId() : 0, match->getScore());
+    manager->recordMatchResult(result);
+}
+
+// Refills the rolling window from the newest day blocks only, stopping once a block
+// falls before the window that ends on the latest completed result.
+void Task4_GameResultManager::rebuildRollingForm() {
+    rolling_form.clear();
+    for (int b = match_table.dayBlockCount() - 1; b >= 0; b--) {
+        int day = match_table.dayBlock(b).day;
+        if (rolling_form.lastDay() != -1 && day <= rolling_form.lastDay() - rolling_form.windowDays()) break;
+        const Task4_Bitmap* rows = match_table.rowsOnDay(day);
+        for (int row = rows->nextRow(0); row != -1; row = rows->nextRow(row + 1)) applyRowToForm(row, 1);
+    }
+}
+
+// The recent stack only holds the newest TASK4_MAX_CAPACITY matches; the table keeps them all.
+void Task4_GameResultManager::refillRecentMatches() {
+    while (!recent_matches.isEmpty()) { Task4_MatchResult temp; recent_matches.pop(temp); }
+    int first_recent = match_table.size() > TASK4_MAX_CAPACITY ? match_table.size() - TASK4_MAX_CAPACITY : 0;
+    for (int row = first_recent; row < match_table.size(); row++) {
+        Task4_MatchResult match_res;
+        match_table.getRow(row, match_res);
+        recent_matches.push(match_res);
+    }
+}
+
+// Archives, as a new season, every resident match the archive does not hold yet, so
+// reloading matches.csv or the archive itself never stores a match twice.
+bool Task4_GameResultManager::saveSeasonSnapshot(const std::string& path) {
+    int season_id = 1;
+    Task4_IntIndex archived; // match_id -> season index
+    FILE* probe = fopen(path.c_str(), "rb");
+    if (probe) { // Number the new season after the last one, and never append to a damaged archive
+        fclose(probe);
+        Task4_Snapshot existing;
+        if (!existing.open(path)) return false;
+        std::string names[TASK4_MAX_CODES * 2];
+        for (int season = 0; season < existing.seasonCount(); season++) {
+            Task4_ColumnView view;
+            existing.seasonColumns(season, view, names);
+            for (int i = 0; i < view.rows; i++) archived.put(view.match_ids[i], season);
+        }
+        if (existing.seasonCount() > 0) season_id = existing.seasonId(existing.seasonCount() - 1) + 1;
+        if (!existing.dropTornTail(path)) return false;
+    }
+    Task4_MatchTable season;
+    for (int row = 0; row < match_table.size(); row++) {
+        int archived_season;
+        if (archived.find(match_table.matchId(row), archived_season)) continue;
+        Task4_MatchResult r;
+        match_table.getRow(row, r);
+        season.append(r.match_id, r.stage, r.group_id, r.round, r.player1_id, r.player2_id, r.scheduled_time, r.status,
+                      r.winner_id, r.score);
+    }
+    if (season.size() == 0) { std::cout << "Task 4: Every resident match is already in the archive.\n"; return false; }
+    Task4_ColumnView view;
+    season.columnsOf(0, season.size(), view);
+    if (!Task4_Snapshot::appendSeason(path, season_id, view, player_stats, current_player_count)) return false;
+    std::cout << "Task 4: Saved season " << season_id << " (" << season.size() << " matches, " << current_player_count
+              << " players) to '" << path << "'.\n";
+    return true;
+}
+
+bool Task4_GameResultManager::loadSnapshot(const std::string& path) {
+    Task4_Snapshot snapshot;
+    if (!snapshot.open(path)) return false;
+
+    current_player_count = 0;
+    player_index.clear();
+    leaderboard.clear();
+    match_table.clear();
+    next_match_id = 1;
+    std::string names[TASK4_MAX_CODES * 2];
+    for (int season = 0; season < snapshot.seasonCount(); season++) {
+        for (int i = 0; i < snapshot.seasonPlayerCount(season); i++) {
+            Task4_SnapshotPlayer sp = snapshot.seasonPlayer(season, i);
+            int index = findPlayerIndex(sp.player_id);
+            if (index == -1) { // A later season's details replace an earlier one's
+                if (current_player_count == task4_max_players) {
+                    std::cerr << "Task 4 Warning: Player capacity reached, skipping player " << sp.player_id << "." << std::endl;
+                    continue;
+                }
+                index = current_player_count++;
+                player_index.putIfAbsent(sp.player_id, index);
+            }
+            player_stats[index] = Task4_PlayerStats(sp.player_id, sp.name, sp.rank, sp.contact, sp.registration);
+        }
+        Task4_ColumnView view;
+        snapshot.seasonColumns(season, view, names);
+        match_table.appendColumns(view);
+        for (int i = 0; i < view.rows; i++) {
+            if (view.match_ids[i] >= next_match_id) next_match_id = view.match_ids[i] + 1;
+        }
+        std::cout << "Task 4: Season " << snapshot.seasonId(season) << ": " << view.rows << " matches, "
+                  << snapshot.seasonPlayerCount(season) << " players.\n";
+    }
+    rebuildPlayerStats();
+    refillRecentMatches();
+    data_loaded = true;
+    std::cout << "Task 4: Loaded " << snapshot.seasonCount() << " season(s) from '" << path << "'. Match table rows: "
+              << match_table.size() << ", players: " << current_player_count << std::endl;
+    return true;
+}
+
+bool Task4_GameResultManager::exportMatches(const std::string& filename, Task4_ExportFormat format) {
+    BufferedWriter out;
+    if (!out.open(filename.c_str())) {
+        std::cerr << "Task 4 Warning: Cannot open '" << filename << "' for writing." << std::endl;
+        return false;
+    }
+    if (format == TASK4_EXPORT_JSONL) match_table.writeJSONLines(out);
+    else if (format == TASK4_EXPORT_COLUMNAR) match_table.writeColumnar(out);
+    else match_table.writeCSV(out);
+    long long bytes = out.bytesWritten();
+    if (!out.close()) { std::cerr << "Task 4 Warning: Writing '" << filename << "' failed." << std::endl; return false; }
+    std::cout << "Task 4: Exported " << match_table.size() << " matches to '" << filename << "' (" << bytes << " bytes).\n";
+    return true;
+}
+
+bool Task4_GameResultManager::exportPlayerStats(const std::string& filename, Task4_ExportFormat format) {
+    BufferedWriter out;
+    if (!out.open(filename.c_str())) {
+        std::cerr << "Task 4 Warning: Cannot open '" << filename << "' for writing." << std::endl;
+        return false;
+    }
+    bool jsonl = format == TASK4_EXPORT_JSONL;
+    if (!jsonl) out.write("player_id,name,rank,matches,wins,losses,win_rate,avg_score,leaderboard_rank\n");
+    for (int i = 0; i < current_player_count; i++) {
+        const Task4_PlayerStats& ps = player_stats[i];
+        double win_rate = ps.total_matches > 0 ? 100.0 * ps.wins / ps.total_matches : 0.0;
+        if (jsonl) {
+            out.write("{\"player_id\":"); out.writeInt(ps.player_id);
+            out.write(",\"name\":"); out.writeJsonString(ps.name.c_str());
+            out.write(",\"rank\":"); out.writeJsonString(ps.rank.c_str());
+            out.write(",\"matches\":"); out.writeInt(ps.total_matches);
+            out.write(",\"wins\":"); out.writeInt(ps.wins);
+            out.write(",\"losses\":"); out.writeInt(ps.losses);
+            out.write(",\"win_rate\":"); out.writeFixed(win_rate, 2);
+            out.write(",\"avg_score\":"); out.writeFixed(ps.averageScore(), 2);
+            out.write(",\"leaderboard_rank\":"); out.writeInt(leaderboard.rankOf(i));
+            out.write("}\n");
+        } else {
+            out.writeInt(ps.player_id); out.put(',');
+            out.writeCsvQuoted(ps.name.c_str()); out.put(',');
+            out.writeCsvQuoted(ps.rank.c_str()); out.put(',');
+            out.writeInt(ps.total_matches); out.put(',');
+            out.writeInt(ps.wins); out.put(',');
+            out.writeInt(ps.losses); out.put(',');
+            out.writeFixed(win_rate, 2); out.put(',');
+            out.writeFixed(ps.averageScore(), 2); out.put(',');
+            out.writeInt(leaderboard.rankOf(i)); out.put('\n');
+        }
+    }
+    if (!out.close()) { std::cerr << "Task 4 Warning: Writing '" << filename << "' failed." << std::endl; return false; }
+    std::cout << "Task 4: Exported stats for " << current_player_count << " players to '" << filename << "'.\n";
+    return true;
+}
+
+// Recomputes every player's stats from the match table in one batch.
+void Task4_GameResultManager::rebuildPlayerStats() {
+    head_to_head.build(match_table);
+    rebuildRollingForm();
+    for (int i = 0; i < current_player_count; i++) {
+        player_stats[i].total_matches = player_stats[i].wins = player_stats[i].losses = 0;
+        player_stats[i].score_total = 0;
+    }
+    int totals_count = match_table.playerCount();
+    if (totals_count == 0) {
+        for (int i = 0; i < current_player_count; i++) refreshRank(i);
+        return;
+    }
+    Task4_PlayerTotals* totals = new Task4_PlayerTotals[totals_count];
+    match_table.aggregatePlayerTotals(totals);
+    for (int slot = 0; slot < totals_count; slot++) {
+        int index = findPlayerIndex(totals[slot].player_id);
+        if (index == -1) continue; // Not a registered player
+        Task4_PlayerStats& ps_ref = player_stats[index];
+        ps_ref.total_matches = totals[slot].matches;
+        ps_ref.wins = totals[slot].wins;
+        ps_ref.losses = totals[slot].losses;
+        ps_ref.score_total = totals[slot].score_total;
+    }
+    delete[] totals;
+    for (int i = 0; i < current_player_count; i++) refreshRank(i);
+}
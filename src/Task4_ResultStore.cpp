@@ -0,0 +1,2012 @@
+// Task4_ResultStore.cpp
+// Task 4 storage: the columnar match table and its indexes, leaderboard,
+// head-to-head records, rolling form and the binary season archive.
+
+#include "../EsportsChampionship.hpp"
+
+// Platform headers for the snapshot (memory-mapped reads) and popcount
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Task 4: Result Logging Implementations
+// From EsportsChampionship.cpp. Using std:: prefix as in original.
+
+Task4_MatchResult::Task4_MatchResult() : match_id(0), group_id(0), round(0), player1_id(0), player2_id(0), winner_id(0) {
+    // stage, scheduled_time, status, score are std::string and default-construct to empty.
+}
+
+Task4_MatchResult::Task4_MatchResult(int mid, const std::string& st, int gid, int r, int p1, int p2,
+                                   const std::string& sch_time, const std::string& stat, int wid, const std::string& scr)
+    : match_id(mid), stage(st), group_id(gid), round(r), player1_id(p1), player2_id(p2),
+      scheduled_time(sch_time), status(stat), winner_id(wid), score(scr) {}
+
+// Task4_Stack implementations
+Task4_Stack::Task4_Stack() : top_index(-1), count(0) {} // Stack is empty
+
+bool Task4_Stack::push(const Task4_MatchResult& match) {
+    if (count >= TASK4_MAX_CAPACITY) {
+        std::cerr << "Task 4 Warning: Stack is full. Cannot push match ID " << match.match_id << std::endl;
+        return false;
+    }
+    pushEvictOldest(match);
+    return true;
+}
+
+void Task4_Stack::pushEvictOldest(const Task4_MatchResult& match) {
+    top_index = (top_index + 1) % TASK4_MAX_CAPACITY; // When full this is the bottom slot
+    data[top_index] = match;
+    if (count < TASK4_MAX_CAPACITY) count++;
+}
+
+bool Task4_Stack::replace(const Task4_MatchResult& match) {
+    for (int i = 0; i < count; i++) {
+        Task4_MatchResult& entry = data[(top_index - i + TASK4_MAX_CAPACITY) % TASK4_MAX_CAPACITY];
+        if (entry.match_id == match.match_id) {
+            entry = match;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Task4_Stack::pop(Task4_MatchResult& out_match) {
+    if (isEmpty()) {
+        // std::cerr << "Task 4 Warning: Stack is empty. Cannot pop." << std::endl; // Optional: too verbose
+        return false;
+    }
+    out_match = data[top_index];
+    top_index = (top_index - 1 + TASK4_MAX_CAPACITY) % TASK4_MAX_CAPACITY;
+    count--;
+    return true;
+}
+
+bool Task4_Stack::peek(Task4_MatchResult& out_match) const {
+    if (isEmpty()) {
+        return false;
+    }
+    out_match = data[top_index];
+    return true;
+}
+
+bool Task4_Stack::getFromTop(int index_from_top, Task4_MatchResult& out_match) const {
+    if (isEmpty() || index_from_top < 0 || index_from_top >= count) {
+        return false; // Index out of bounds or stack empty
+    }
+    out_match = data[(top_index - index_from_top + TASK4_MAX_CAPACITY) % TASK4_MAX_CAPACITY];
+    return true;
+}
+
+bool Task4_Stack::isEmpty() const { return count == 0; }
+int Task4_Stack::size() const { return count; }
+
+// Task4_Queue (Circular Queue) implementations
+Task4_Queue::Task4_Queue() : front_index(0), rear_index(-1), current_size(0) {}
+
+bool Task4_Queue::enqueue(const Task4_MatchResult& match) {
+    if (current_size >= TASK4_MAX_CAPACITY) {
+        std::cerr << "Task 4 Warning: Queue is full. Cannot enqueue match ID " << match.match_id << std::endl;
+        return false;
+    }
+    rear_index = (rear_index + 1) % TASK4_MAX_CAPACITY;
+    data[rear_index] = match;
+    current_size++;
+    return true;
+}
+
+bool Task4_Queue::dequeue(Task4_MatchResult& out_match) {
+    if (isEmpty()) {
+        // std::cerr << "Task 4 Warning: Queue is empty. Cannot dequeue." << std::endl; // Optional
+        return false;
+    }
+    out_match = data[front_index];
+    front_index = (front_index + 1) % TASK4_MAX_CAPACITY;
+    current_size--;
+    return true;
+}
+
+bool Task4_Queue::peek(Task4_MatchResult& out_match) const {
+   if (isEmpty()) return false;
+   out_match = data[front_index];
+   return true;
+}
+
+bool Task4_Queue::getAt(int logical_index, Task4_MatchResult& out_match) const {
+    if (isEmpty() || logical_index < 0 || logical_index >= current_size) {
+        return false; // Index out of bounds or queue empty
+    }
+    int actual_index = (front_index + logical_index) % TASK4_MAX_CAPACITY;
+    out_match = data[actual_index];
+    return true;
+}
+
+bool Task4_Queue::isEmpty() const { return current_size == 0; }
+int Task4_Queue::size() const { return current_size; }
+
+// Task4_PlayerStats implementations
+Task4_PlayerStats::Task4_PlayerStats()
+    : player_id(0), total_matches(0), wins(0), losses(0), score_total(0) {
+    // name, rank, contact, registration_time are std::string and default-construct to empty.
+}
+
+Task4_PlayerStats::Task4_PlayerStats(int pid, const std::string& n, const std::string& r_val, // Renamed r to r_val
+                                     const std::string& c, const std::string& reg_time)
+    : player_id(pid), name(n), rank(r_val), contact(c), registration_time(reg_time),
+      total_matches(0), wins(0), losses(0), score_total(0) {}
+
+double Task4_PlayerStats::averageScore() const {
+    return total_matches > 0 ? static_cast<double>(score_total) / total_matches : 0.0;
+}
+
+// Every Task 4 array is counted under the history tag of the memory report.
+template <typename T>
+static T* task4_newArray(size_t count) {
+    return MemoryTracker::allocateArray<T>(count, MEMORY_TASK4_HISTORY);
+}
+
+template <typename T>
+static void task4_deleteArray(T* array) {
+    MemoryTracker::releaseArray(array);
+}
+
+// Helper to resize one column, copying the rows already stored.
+template <typename T>
+static T* task4_resizeColumn(T* old_column, int used, int capacity) {
+    T* column = task4_newArray<T>(capacity);
+    if (used > 0) memcpy(column, old_column, sizeof(T) * used);
+    task4_deleteArray(old_column);
+    return column;
+}
+
+// Task4_IntIndex implementations
+Task4_IntIndex::Task4_IntIndex() : keys(nullptr), values(nullptr), used(nullptr), capacity(0), count(0) {}
+
+Task4_IntIndex::~Task4_IntIndex() {
+    task4_deleteArray(keys);
+    task4_deleteArray(values);
+    task4_deleteArray(used);
+}
+
+void Task4_IntIndex::clear() {
+    if (used) memset(used, 0, capacity);
+    count = 0;
+}
+
+// Multiplicative hashing spreads sequential ids (101, 102, ...) across the table.
+static unsigned int task4_hashInt(int key) {
+    return (unsigned int)key * 2654435761u;
+}
+
+bool Task4_IntIndex::find(int key, int& value) const {
+    if (count == 0) return false;
+    unsigned int mask = (unsigned int)capacity - 1;
+    for (unsigned int i = task4_hashInt(key) & mask; used[i]; i = (i + 1) & mask) {
+        if (keys[i] == key) { value = values[i]; return true; }
+    }
+    return false;
+}
+
+void Task4_IntIndex::put(int key, int value) {
+    if ((count + 1) * 2 > capacity) rehash(capacity > 0 ? capacity * 2 : 16); // load factor <= 0.5
+    unsigned int mask = (unsigned int)capacity - 1;
+    unsigned int i = task4_hashInt(key) & mask;
+    while (used[i] && keys[i] != key) i = (i + 1) & mask;
+    if (!used[i]) { used[i] = 1; keys[i] = key; count++; }
+    values[i] = value;
+}
+
+bool Task4_IntIndex::putIfAbsent(int key, int value) {
+    int existing;
+    if (find(key, existing)) return false;
+    put(key, value);
+    return true;
+}
+
+int Task4_IntIndex::size() const { return count; }
+
+void Task4_IntIndex::rehash(int new_capacity) {
+    int* old_keys = keys;
+    int* old_values = values;
+    unsigned char* old_used = used;
+    int old_capacity = capacity;
+    keys = task4_newArray<int>(new_capacity);
+    values = task4_newArray<int>(new_capacity);
+    used = task4_newArray<unsigned char>(new_capacity);
+    memset(used, 0, new_capacity);
+    capacity = new_capacity;
+    count = 0;
+    for (int i = 0; i < old_capacity; i++) {
+        if (old_used[i]) put(old_keys[i], old_values[i]);
+    }
+    task4_deleteArray(old_keys);
+    task4_deleteArray(old_values);
+    task4_deleteArray(old_used);
+}
+
+// Task4_Bitmap implementations
+static inline int task4_popcount64(uint64_t x) {
+#if defined(_MSC_VER)
+    return (int)__popcnt64(x);
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+Task4_Bitmap::Task4_Bitmap() : containers(nullptr), container_count(0), container_capacity(0) {}
+
+Task4_Bitmap::~Task4_Bitmap() {
+    clear();
+    task4_deleteArray(containers);
+}
+
+void Task4_Bitmap::clear() {
+    for (int i = 0; i < container_count; i++) freeContainer(containers[i]);
+    container_count = 0;
+}
+
+void Task4_Bitmap::freeContainer(Container& c) {
+    task4_deleteArray(c.values);
+    task4_deleteArray(c.words);
+    c.values = nullptr;
+    c.words = nullptr;
+    c.cardinality = c.capacity = 0;
+}
+
+void Task4_Bitmap::copyContainer(Container& dst, const Container& src) {
+    dst.key = src.key;
+    dst.cardinality = src.cardinality;
+    dst.values = nullptr;
+    dst.words = nullptr;
+    dst.capacity = 0;
+    if (src.words) {
+        dst.words = task4_newArray<uint64_t>(WORDS);
+        memcpy(dst.words, src.words, sizeof(uint64_t) * WORDS);
+    } else if (src.cardinality > 0) {
+        dst.capacity = src.cardinality;
+        dst.values = task4_newArray<uint16_t>(dst.capacity);
+        memcpy(dst.values, src.values, sizeof(uint16_t) * src.cardinality);
+    }
+}
+
+int Task4_Bitmap::findContainer(uint16_t key) const {
+    int lo = 0, hi = container_count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (containers[mid].key < key) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+void Task4_Bitmap::insertContainer(int pos, const Container& c) {
+    if (container_count == container_capacity) {
+        int capacity = container_capacity > 0 ? container_capacity * 2 : 4;
+        Container* grown = task4_newArray<Container>(capacity);
+        if (container_count > 0) memcpy(grown, containers, sizeof(Container) * container_count);
+        task4_deleteArray(containers);
+        containers = grown;
+        container_capacity = capacity;
+    }
+    memmove(containers + pos + 1, containers + pos, sizeof(Container) * (container_count - pos));
+    containers[pos] = c;
+    container_count++;
+}
+
+Task4_Bitmap::Container& Task4_Bitmap::containerAt(uint16_t key) {
+    // Rows are usually added in increasing order, so check the last chunk first.
+    if (container_count > 0 && containers[container_count - 1].key == key) return containers[container_count - 1];
+    int pos = findContainer(key);
+    if (pos == container_count || containers[pos].key != key) {
+        Container c;
+        c.key = key;
+        c.cardinality = 0;
+        c.values = nullptr;
+        c.capacity = 0;
+        c.words = nullptr;
+        insertContainer(pos, c);
+    }
+    return containers[pos];
+}
+
+bool Task4_Bitmap::containerHas(const Container& c, uint16_t low) {
+    if (c.words) return (c.words[low >> 6] >> (low & 63)) & 1u;
+    int lo = 0, hi = c.cardinality;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (c.values[mid] < low) lo = mid + 1; else hi = mid;
+    }
+    return lo < c.cardinality && c.values[lo] == low;
+}
+
+void Task4_Bitmap::toBitmap(Container& c) {
+    if (c.words) return;
+    c.words = task4_newArray<uint64_t>(WORDS);
+    memset(c.words, 0, sizeof(uint64_t) * WORDS);
+    for (int i = 0; i < c.cardinality; i++) c.words[c.values[i] >> 6] |= (uint64_t)1 << (c.values[i] & 63);
+    task4_deleteArray(c.values);
+    c.values = nullptr;
+    c.capacity = 0;
+}
+
+void Task4_Bitmap::toArrayIfSparse(Container& c) {
+    if (!c.words || c.cardinality > ARRAY_MAX) return;
+    c.capacity = c.cardinality > 0 ? c.cardinality : 1;
+    c.values = task4_newArray<uint16_t>(c.capacity);
+    int n = 0;
+    for (int w = 0; w < WORDS; w++) {
+        uint64_t bits = c.words[w];
+        while (bits) {
+            int b = 0;
+            while (!((bits >> b) & 1u)) b++;
+            c.values[n++] = (uint16_t)(w * 64 + b);
+            bits &= bits - 1;
+        }
+    }
+    task4_deleteArray(c.words);
+    c.words = nullptr;
+}
+
+void Task4_Bitmap::addToContainer(Container& c, uint16_t low) {
+    if (c.words) {
+        uint64_t bit = (uint64_t)1 << (low & 63);
+        if (!(c.words[low >> 6] & bit)) { c.words[low >> 6] |= bit; c.cardinality++; }
+        return;
+    }
+    int pos = c.cardinality;
+    if (pos > 0 && c.values[pos - 1] >= low) { // out-of-order add: find the slot
+        int lo = 0, hi = c.cardinality;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (c.values[mid] < low) lo = mid + 1; else hi = mid;
+        }
+        if (lo < c.cardinality && c.values[lo] == low) return;
+        pos = lo;
+    }
+    if (c.cardinality == ARRAY_MAX) {
+        toBitmap(c);
+        addToContainer(c, low);
+        return;
+    }
+    if (c.cardinality == c.capacity) {
+        int capacity = c.capacity > 0 ? c.capacity * 2 : 4;
+        if (capacity > ARRAY_MAX) capacity = ARRAY_MAX;
+        uint16_t* grown = task4_newArray<uint16_t>(capacity);
+        if (c.cardinality > 0) memcpy(grown, c.values, sizeof(uint16_t) * c.cardinality);
+        task4_deleteArray(c.values);
+        c.values = grown;
+        c.capacity = capacity;
+    }
+    memmove(c.values + pos + 1, c.values + pos, sizeof(uint16_t) * (c.cardinality - pos));
+    c.values[pos] = low;
+    c.cardinality++;
+}
+
+void Task4_Bitmap::add(int row) {
+    if (row < 0) return;
+    addToContainer(containerAt((uint16_t)(row >> 16)), (uint16_t)(row & 0xFFFF));
+}
+
+void Task4_Bitmap::remove(int row) {
+    if (row < 0) return;
+    int pos = findContainer((uint16_t)(row >> 16));
+    if (pos == container_count || containers[pos].key != (row >> 16)) return;
+    Container& c = containers[pos];
+    uint16_t low = (uint16_t)(row & 0xFFFF);
+    if (!containerHas(c, low)) return;
+    if (c.words) {
+        c.words[low >> 6] &= ~((uint64_t)1 << (low & 63));
+        c.cardinality--;
+        toArrayIfSparse(c);
+    } else {
+        int i = 0;
+        while (c.values[i] != low) i++;
+        memmove(c.values + i, c.values + i + 1, sizeof(uint16_t) * (c.cardinality - i - 1));
+        c.cardinality--;
+    }
+    if (c.cardinality == 0) {
+        freeContainer(c);
+        memmove(containers + pos, containers + pos + 1, sizeof(Container) * (container_count - pos - 1));
+        container_count--;
+    }
+}
+
+void Task4_Bitmap::addRange(int first_row, int end_row) {
+    if (first_row < 0) first_row = 0;
+    while (first_row < end_row) {
+        uint16_t key = (uint16_t)(first_row >> 16);
+        int chunk_end = ((int)key + 1) << 16;
+        int stop = end_row < chunk_end ? end_row : chunk_end;
+        Container& c = containerAt(key);
+        if (stop - first_row > ARRAY_MAX) toBitmap(c);
+        for (int row = first_row; row < stop; row++) addToContainer(c, (uint16_t)(row & 0xFFFF));
+        first_row = stop;
+    }
+}
+
+bool Task4_Bitmap::contains(int row) const {
+    if (row < 0) return false;
+    int pos = findContainer((uint16_t)(row >> 16));
+    return pos < container_count && containers[pos].key == (row >> 16) && containerHas(containers[pos], (uint16_t)(row & 0xFFFF));
+}
+
+int Task4_Bitmap::cardinality() const {
+    int total = 0;
+    for (int i = 0; i < container_count; i++) total += containers[i].cardinality;
+    return total;
+}
+
+int Task4_Bitmap::nextRow(int from_row) const {
+    if (from_row < 0) from_row = 0;
+    for (int i = findContainer((uint16_t)(from_row >> 16)); i < container_count; i++) {
+        const Container& c = containers[i];
+        int base = (int)c.key << 16;
+        int low = from_row > base ? from_row - base : 0;
+        if (low > 0xFFFF) continue;
+        if (c.words) {
+            int w = low >> 6;
+            uint64_t bits = c.words[w] & (~(uint64_t)0 << (low & 63));
+            while (true) {
+                if (bits) {
+                    int b = 0;
+                    while (!((bits >> b) & 1u)) b++;
+                    return base + w * 64 + b;
+                }
+                if (++w == WORDS) break;
+                bits = c.words[w];
+            }
+        } else {
+            int lo = 0, hi = c.cardinality;
+            while (lo < hi) {
+                int mid = (lo + hi) / 2;
+                if (c.values[mid] < low) lo = mid + 1; else hi = mid;
+            }
+            if (lo < c.cardinality) return base + c.values[lo];
+        }
+    }
+    return -1;
+}
+
+void Task4_Bitmap::copyFrom(const Task4_Bitmap& other) {
+    if (&other == this) return;
+    clear();
+    for (int i = 0; i < other.container_count; i++) {
+        Container c;
+        copyContainer(c, other.containers[i]);
+        insertContainer(container_count, c);
+    }
+}
+
+// In-place intersection of two chunks with the same key.
+void Task4_Bitmap::andContainer(Container& c, const Container& other) {
+    if (c.words && other.words) {
+        int card = 0;
+        for (int w = 0; w < WORDS; w++) { // plain loop, vectorised by the compiler
+            c.words[w] &= other.words[w];
+            card += task4_popcount64(c.words[w]);
+        }
+        c.cardinality = card;
+        toArrayIfSparse(c);
+    } else if (c.words) { // bitmap AND array: keep the array values that are set
+        uint16_t* values = task4_newArray<uint16_t>(other.cardinality > 0 ? other.cardinality : 1);
+        int n = 0;
+        for (int i = 0; i < other.cardinality; i++) {
+            if (containerHas(c, other.values[i])) values[n++] = other.values[i];
+        }
+        task4_deleteArray(c.words);
+        c.words = nullptr;
+        c.values = values;
+        c.capacity = other.cardinality > 0 ? other.cardinality : 1;
+        c.cardinality = n;
+    } else { // array AND (array or bitmap): filter in place
+        int n = 0;
+        if (other.words) {
+            for (int i = 0; i < c.cardinality; i++) {
+                if (containerHas(other, c.values[i])) c.values[n++] = c.values[i];
+            }
+        } else {
+            int j = 0;
+            for (int i = 0; i < c.cardinality && j < other.cardinality; ) {
+                if (c.values[i] < other.values[j]) i++;
+                else if (c.values[i] > other.values[j]) j++;
+                else { c.values[n++] = c.values[i]; i++; j++; }
+            }
+        }
+        c.cardinality = n;
+    }
+}
+
+// In-place union of two chunks with the same key.
+void Task4_Bitmap::orContainer(Container& c, const Container& other) {
+    if (c.words || other.words || c.cardinality + other.cardinality > ARRAY_MAX) {
+        toBitmap(c);
+        int card = 0;
+        if (other.words) {
+            for (int w = 0; w < WORDS; w++) {
+                c.words[w] |= other.words[w];
+                card += task4_popcount64(c.words[w]);
+            }
+        } else {
+            for (int i = 0; i < other.cardinality; i++) c.words[other.values[i] >> 6] |= (uint64_t)1 << (other.values[i] & 63);
+            for (int w = 0; w < WORDS; w++) card += task4_popcount64(c.words[w]);
+        }
+        c.cardinality = card;
+        toArrayIfSparse(c);
+        return;
+    }
+    int capacity = c.cardinality + other.cardinality;
+    uint16_t* values = task4_newArray<uint16_t>(capacity > 0 ? capacity : 1);
+    int i = 0, j = 0, n = 0;
+    while (i < c.cardinality || j < other.cardinality) {
+        if (j == other.cardinality || (i < c.cardinality && c.values[i] < other.values[j])) values[n++] = c.values[i++];
+        else if (i == c.cardinality || other.values[j] < c.values[i]) values[n++] = other.values[j++];
+        else { values[n++] = c.values[i++]; j++; }
+    }
+    task4_deleteArray(c.values);
+    c.values = values;
+    c.capacity = capacity > 0 ? capacity : 1;
+    c.cardinality = n;
+}
+
+void Task4_Bitmap::andWith(const Task4_Bitmap& other) {
+    int kept = 0, j = 0;
+    for (int i = 0; i < container_count; i++) {
+        Container& c = containers[i];
+        while (j < other.container_count && other.containers[j].key < c.key) j++;
+        if (j < other.container_count && other.containers[j].key == c.key) andContainer(c, other.containers[j]);
+        else freeContainer(c);
+        if (c.cardinality > 0) containers[kept++] = c;
+        else freeContainer(c);
+    }
+    container_count = kept;
+}
+
+void Task4_Bitmap::orWith(const Task4_Bitmap& other) {
+    for (int j = 0; j < other.container_count; j++) {
+        const Container& o = other.containers[j];
+        int pos = findContainer(o.key);
+        if (pos < container_count && containers[pos].key == o.key) {
+            orContainer(containers[pos], o);
+        } else {
+            Container c;
+            copyContainer(c, o);
+            insertContainer(pos, c);
+        }
+    }
+}
+
+// Task4_BitmapIndex implementations
+Task4_BitmapIndex::Task4_BitmapIndex() : keys(nullptr), bitmaps(nullptr), count(0), capacity(0) {}
+
+Task4_BitmapIndex::~Task4_BitmapIndex() {
+    clear();
+    task4_deleteArray(keys);
+    task4_deleteArray(bitmaps);
+}
+
+void Task4_BitmapIndex::clear() {
+    for (int i = 0; i < count; i++) delete bitmaps[i];
+    count = 0;
+    slots.clear();
+}
+
+void Task4_BitmapIndex::add(int key, int row) {
+    int slot;
+    if (!slots.find(key, slot)) {
+        if (count == capacity) {
+            capacity = capacity > 0 ? capacity * 2 : 8;
+            keys = task4_resizeColumn(keys, count, capacity);
+            bitmaps = task4_resizeColumn(bitmaps, count, capacity);
+        }
+        slot = count++;
+        keys[slot] = key;
+        bitmaps[slot] = new Task4_Bitmap();
+        slots.put(key, slot);
+    }
+    bitmaps[slot]->add(row);
+}
+
+void Task4_BitmapIndex::remove(int key, int row) {
+    int slot;
+    if (slots.find(key, slot)) bitmaps[slot]->remove(row);
+}
+
+const Task4_Bitmap* Task4_BitmapIndex::find(int key) const {
+    int slot;
+    return slots.find(key, slot) ? bitmaps[slot] : nullptr;
+}
+
+int Task4_BitmapIndex::keyCount() const { return count; }
+int Task4_BitmapIndex::keyAt(int i) const { return keys[i]; }
+const Task4_Bitmap* Task4_BitmapIndex::bitmapAt(int i) const { return bitmaps[i]; }
+
+Task4_MatchFilter::Task4_MatchFilter() : round(-1), group_id(-1) {}
+
+// Task4_MatchTable implementations
+Task4_MatchTable::Task4_MatchTable()
+    : match_ids(nullptr), group_ids(nullptr), player1_ids(nullptr), player2_ids(nullptr), winner_ids(nullptr),
+      player1_slots(nullptr), player2_slots(nullptr), rounds(nullptr), stage_codes(nullptr), status_codes(nullptr), scores(nullptr), scheduled_times(nullptr),
+      time_formats(nullptr),
+      row_count(0), row_capacity(0), stage_dict_size(0), status_dict_size(0), completed_code(-1),
+      day_blocks(nullptr), day_block_count(0), day_block_capacity(0),
+      postings(nullptr), posting_count(0), posting_capacity(0) {}
+
+Task4_MatchTable::~Task4_MatchTable() {
+    task4_deleteArray(match_ids); task4_deleteArray(group_ids); task4_deleteArray(player1_ids); task4_deleteArray(player2_ids); task4_deleteArray(winner_ids);
+    task4_deleteArray(player1_slots); task4_deleteArray(player2_slots); task4_deleteArray(rounds); task4_deleteArray(stage_codes); task4_deleteArray(status_codes); task4_deleteArray(scores); task4_deleteArray(scheduled_times);
+    task4_deleteArray(time_formats);
+    for (int i = 0; i < posting_count; i++) task4_deleteArray(postings[i].rows);
+    task4_deleteArray(postings);
+    task4_deleteArray(day_blocks);
+}
+
+// Keeps the allocated columns; only the rows and dictionaries are dropped.
+void Task4_MatchTable::clear() {
+    row_count = 0;
+    stage_dict_size = 0;
+    status_dict_size = 0;
+    completed_code = -1;
+    for (int i = 0; i < posting_count; i++) task4_deleteArray(postings[i].rows);
+    posting_count = 0;
+    posting_slots.clear();
+    match_rows.clear();
+    stage_index.clear();
+    status_index.clear();
+    round_index.clear();
+    group_index.clear();
+    day_index.clear();
+    day_block_count = 0;
+}
+
+void Task4_MatchTable::reserve(int rows) {
+    if (rows > row_capacity) grow(rows);
+}
+
+void Task4_MatchTable::grow(int min_capacity) {
+    int capacity = row_capacity > 0 ? row_capacity : 64;
+    while (capacity < min_capacity) capacity *= 2;
+    match_ids = task4_resizeColumn(match_ids, row_count, capacity);
+    group_ids = task4_resizeColumn(group_ids, row_count, capacity);
+    player1_ids = task4_resizeColumn(player1_ids, row_count, capacity);
+    player2_ids = task4_resizeColumn(player2_ids, row_count, capacity);
+    winner_ids = task4_resizeColumn(winner_ids, row_count, capacity);
+    player1_slots = task4_resizeColumn(player1_slots, row_count, capacity);
+    player2_slots = task4_resizeColumn(player2_slots, row_count, capacity);
+    rounds = task4_resizeColumn(rounds, row_count, capacity);
+    stage_codes = task4_resizeColumn(stage_codes, row_count, capacity);
+    status_codes = task4_resizeColumn(status_codes, row_count, capacity);
+    scores = task4_resizeColumn(scores, row_count, capacity);
+    scheduled_times = task4_resizeColumn(scheduled_times, row_count, capacity);
+    time_formats = task4_resizeColumn(time_formats, row_count, capacity);
+    row_capacity = capacity;
+}
+
+// Returns the dictionary code for name, adding it if there is room.
+// Names past TASK4_MAX_CODES share the last code.
+int Task4_MatchTable::internCode(std::string dict[], int& dict_size, const std::string& name) {
+    for (int i = 0; i < dict_size; i++) {
+        if (dict[i] == name) return i;
+    }
+    if (dict_size == TASK4_MAX_CODES) {
+        std::cerr << "Task 4 Warning: Too many distinct values, '" << name << "' stored as '" << dict[dict_size - 1] << "'." << std::endl;
+        return dict_size - 1;
+    }
+    dict[dict_size] = name;
+    return dict_size++;
+}
+
+int Task4_MatchTable::append(int match_id, const std::string& stage, int group_id, int round_val, int player1_id, int player2_id,
+                             const std::string& scheduled_time, const std::string& status, int winner_id, const std::string& score) {
+    if (rowProblem(round_val, scheduled_time, score)) return -1;
+    if (row_count == row_capacity) grow(row_count + 1);
+    int row = row_count++;
+    match_ids[row] = match_id;
+    group_ids[row] = group_id;
+    player1_ids[row] = player1_id;
+    player2_ids[row] = player2_id;
+    winner_ids[row] = winner_id;
+    rounds[row] = (uint8_t)round_val;
+    stage_codes[row] = (uint8_t)internCode(stage_dict, stage_dict_size, stage);
+    status_codes[row] = (uint8_t)internCode(status_dict, status_dict_size, status);
+    if (completed_code == -1 && status == "completed") completed_code = status_codes[row];
+    scores[row] = packScore(score);
+    scheduled_times[row] = parseScheduledTime(scheduled_time);
+    time_formats[row] = timeFormatOf(scheduled_time);
+    indexRow(row);
+    return row;
+}
+
+void Task4_MatchTable::indexRow(int row) {
+    player1_slots[row] = addPosting(player1_ids[row], row);
+    player2_slots[row] = player2_ids[row] != player1_ids[row] ? addPosting(player2_ids[row], row) : player1_slots[row];
+    stage_index.add(stage_codes[row], row);
+    status_index.add(status_codes[row], row);
+    round_index.add(rounds[row], row);
+    group_index.add(group_ids[row], row);
+    if (scheduled_times[row] >= 0) {
+        day_index.add((int)(scheduled_times[row] / 86400), row);
+        addToDayBlock(row);
+    }
+    match_rows.put(match_ids[row], row);
+}
+
+int Task4_MatchTable::appendColumns(const Task4_ColumnView& block) {
+    int first = row_count;
+    if (block.rows <= 0) return first;
+    if (row_count + block.rows > row_capacity) grow(row_count + block.rows);
+    uint8_t stage_map[256], status_map[256];
+    for (int i = 0; i < 256; i++) stage_map[i] = status_map[i] = 0;
+    for (int i = 0; i < block.stage_name_count && i < 256; i++) stage_map[i] = (uint8_t)internCode(stage_dict, stage_dict_size, block.stage_names[i]);
+    for (int i = 0; i < block.status_name_count && i < 256; i++) {
+        status_map[i] = (uint8_t)internCode(status_dict, status_dict_size, block.status_names[i]);
+        if (completed_code == -1 && block.status_names[i] == "completed") completed_code = status_map[i];
+    }
+    memcpy(match_ids + first, block.match_ids, sizeof(int32_t) * block.rows);
+    memcpy(group_ids + first, block.group_ids, sizeof(int32_t) * block.rows);
+    memcpy(player1_ids + first, block.player1_ids, sizeof(int32_t) * block.rows);
+    memcpy(player2_ids + first, block.player2_ids, sizeof(int32_t) * block.rows);
+    memcpy(winner_ids + first, block.winner_ids, sizeof(int32_t) * block.rows);
+    memcpy(rounds + first, block.rounds, block.rows);
+    memcpy(scores + first, block.scores, sizeof(uint32_t) * block.rows);
+    memcpy(scheduled_times + first, block.scheduled_times, sizeof(int64_t) * block.rows);
+    if (block.time_formats) memcpy(time_formats + first, block.time_formats, block.rows);
+    for (int i = 0; i < block.rows; i++) {
+        if (!block.time_formats) time_formats[first + i] = block.scheduled_times[i] >= 0 ? TIME_SECONDS : TIME_UNKNOWN;
+        stage_codes[first + i] = stage_map[block.stage_codes[i]];
+        status_codes[first + i] = status_map[block.status_codes[i]];
+    }
+    row_count += block.rows;
+    for (int row = first; row < row_count; row++) indexRow(row);
+    return first;
+}
+
+void Task4_MatchTable::columnsOf(int first_row, int count, Task4_ColumnView& out) const {
+    if (first_row < 0) first_row = 0;
+    if (count > row_count - first_row) count = row_count - first_row;
+    out.rows = count > 0 ? count : 0;
+    out.match_ids = match_ids + first_row;
+    out.group_ids = group_ids + first_row;
+    out.player1_ids = player1_ids + first_row;
+    out.player2_ids = player2_ids + first_row;
+    out.winner_ids = winner_ids + first_row;
+    out.rounds = rounds + first_row;
+    out.stage_codes = stage_codes + first_row;
+    out.status_codes = status_codes + first_row;
+    out.scores = scores + first_row;
+    out.scheduled_times = scheduled_times + first_row;
+    out.time_formats = time_formats + first_row;
+    out.stage_names = stage_dict;
+    out.stage_name_count = stage_dict_size;
+    out.status_names = status_dict;
+    out.status_name_count = status_dict_size;
+}
+
+int Task4_MatchTable::findRow(int match_id) const {
+    int row;
+    return match_rows.find(match_id, row) ? row : -1;
+}
+
+bool Task4_MatchTable::updateResult(int row, int player1_id, int player2_id, const std::string& status, int winner_id,
+                                    const std::string& score) {
+    if (row < 0 || row >= row_count || rowProblem(rounds[row], "", score)) return false;
+    if (player1_id != player1_ids[row] || player2_id != player2_ids[row]) {
+        removePosting(player1_slots[row], row);
+        if (player2_slots[row] != player1_slots[row]) removePosting(player2_slots[row], row);
+        player1_ids[row] = player1_id;
+        player2_ids[row] = player2_id;
+        player1_slots[row] = addPosting(player1_id, row);
+        player2_slots[row] = player2_id != player1_id ? addPosting(player2_id, row) : player1_slots[row];
+    }
+    int new_code = internCode(status_dict, status_dict_size, status);
+    if (completed_code == -1 && status == "completed") completed_code = new_code;
+    if (new_code != status_codes[row]) {
+        status_index.remove(status_codes[row], row);
+        status_codes[row] = (uint8_t)new_code;
+        status_index.add(new_code, row);
+    }
+    winner_ids[row] = winner_id;
+    scores[row] = packScore(score);
+    return true;
+}
+
+int Task4_MatchTable::findDayBlock(int day) const {
+    int lo = 0, hi = day_block_count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (day_blocks[mid].day < day) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+// Matches mostly arrive in date order, so the new day is normally appended at the end.
+void Task4_MatchTable::addToDayBlock(int row) {
+    int64_t t = scheduled_times[row];
+    int day = (int)(t / 86400);
+    int pos = day_block_count > 0 && day_blocks[day_block_count - 1].day < day ? day_block_count : findDayBlock(day);
+    if (pos == day_block_count || day_blocks[pos].day != day) {
+        if (day_block_count == day_block_capacity) {
+            day_block_capacity = day_block_capacity > 0 ? day_block_capacity * 2 : 64;
+            day_blocks = task4_resizeColumn(day_blocks, day_block_count, day_block_capacity);
+        }
+        memmove(day_blocks + pos + 1, day_blocks + pos, sizeof(Task4_DayBlock) * (day_block_count - pos));
+        day_block_count++;
+        day_blocks[pos].day = day;
+        day_blocks[pos].min_time = t;
+        day_blocks[pos].max_time = t;
+        day_blocks[pos].rows = 0;
+    }
+    Task4_DayBlock& block = day_blocks[pos];
+    if (t < block.min_time) block.min_time = t;
+    if (t > block.max_time) block.max_time = t;
+    block.rows++;
+}
+
+int Task4_MatchTable::dayBlockCount() const { return day_block_count; }
+const Task4_DayBlock& Task4_MatchTable::dayBlock(int i) const { return day_blocks[i]; }
+const Task4_Bitmap* Task4_MatchTable::rowsOnDay(int day) const { return day_index.find(day); }
+
+int Task4_MatchTable::firstDayBlockFrom(long long from_time) const {
+    int lo = 0, hi = day_block_count;
+    while (lo < hi) { // max_time rises with the day, so this is a plain lower bound
+        int mid = (lo + hi) / 2;
+        if (day_blocks[mid].max_time < from_time) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+// Days outside the range are never visited. Inside it, the cheaper side is walked: the
+// player's posting list, or the rows of the covered day blocks. Only blocks cut by
+// from_time/to_time need a per-row time check.
+int Task4_MatchTable::playerRecordByDay(int player_id, long long from_time, long long to_time, Task4_DayRecord* out) const {
+    int first = firstDayBlockFrom(from_time);
+    int last = first;
+    long long block_rows = 0;
+    while (last < day_block_count && day_blocks[last].min_time <= to_time) block_rows += day_blocks[last++].rows;
+    if (first == last) return 0;
+    for (int b = first; b < last; b++) {
+        out[b - first].block = b;
+        out[b - first].day = day_blocks[b].day;
+        out[b - first].matches = out[b - first].wins = 0;
+    }
+
+    const int* player_rows;
+    int player_row_count = rowsForPlayer(player_id, player_rows);
+    if (player_row_count == 0) return 0;
+    if (player_row_count <= block_rows) {
+        for (int i = 0; i < player_row_count; i++) {
+            int row = player_rows[i];
+            int64_t t = scheduled_times[row];
+            if (t < 0 || t < from_time || t > to_time || !isCompleted(row) || winner_ids[row] == 0) continue;
+            Task4_DayRecord& rec = out[findDayBlock((int)(t / 86400)) - first];
+            rec.matches++;
+            if (winner_ids[row] == player_id) rec.wins++;
+        }
+    } else {
+        for (int b = first; b < last; b++) {
+            const Task4_Bitmap* rows = day_index.find(day_blocks[b].day);
+            bool whole_day = day_blocks[b].min_time >= from_time && day_blocks[b].max_time <= to_time;
+            for (int row = rows->nextRow(0); row != -1; row = rows->nextRow(row + 1)) {
+                if (player1_ids[row] != player_id && player2_ids[row] != player_id) continue;
+                if (!whole_day && (scheduled_times[row] < from_time || scheduled_times[row] > to_time)) continue;
+                if (!isCompleted(row) || winner_ids[row] == 0) continue;
+                out[b - first].matches++;
+                if (winner_ids[row] == player_id) out[b - first].wins++;
+            }
+        }
+    }
+    int written = 0;
+    for (int b = 0; b < last - first; b++) {
+        if (out[b].matches > 0) out[written++] = out[b];
+    }
+    return written;
+}
+
+// Rows are appended in increasing order, so each posting list stays sorted.
+int Task4_MatchTable::addPosting(int player_id, int row) {
+    int slot;
+    if (!posting_slots.find(player_id, slot)) {
+        if (posting_count == posting_capacity) {
+            posting_capacity = posting_capacity > 0 ? posting_capacity * 2 : 64;
+            postings = task4_resizeColumn(postings, posting_count, posting_capacity);
+        }
+        slot = posting_count++;
+        postings[slot].player_id = player_id;
+        postings[slot].rows = nullptr;
+        postings[slot].count = 0;
+        postings[slot].capacity = 0;
+        posting_slots.put(player_id, slot);
+    }
+    PostingList& list = postings[slot];
+    if (list.count == list.capacity) {
+        list.capacity = list.capacity > 0 ? list.capacity * 2 : 4;
+        list.rows = task4_resizeColumn(list.rows, list.count, list.capacity);
+    }
+    int at = list.count; // append() adds rows in order; only updateResult moves an older row in
+    while (at > 0 && list.rows[at - 1] > row) at--;
+    memmove(list.rows + at + 1, list.rows + at, sizeof(int) * (list.count - at));
+    list.rows[at] = row;
+    list.count++;
+    return slot;
+}
+
+void Task4_MatchTable::removePosting(int slot, int row) {
+    PostingList& list = postings[slot];
+    int lo = 0, hi = list.count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (list.rows[mid] < row) lo = mid + 1; else hi = mid;
+    }
+    if (lo == list.count || list.rows[lo] != row) return;
+    memmove(list.rows + lo, list.rows + lo + 1, sizeof(int) * (list.count - lo - 1));
+    list.count--;
+}
+
+int Task4_MatchTable::size() const { return row_count; }
+int Task4_MatchTable::matchId(int row) const { return match_ids[row]; }
+int Task4_MatchTable::groupId(int row) const { return group_ids[row]; }
+int Task4_MatchTable::round(int row) const { return rounds[row]; }
+int Task4_MatchTable::player1Id(int row) const { return player1_ids[row]; }
+int Task4_MatchTable::player2Id(int row) const { return player2_ids[row]; }
+int Task4_MatchTable::winnerId(int row) const { return winner_ids[row]; }
+const std::string& Task4_MatchTable::stageName(int row) const { return stage_dict[stage_codes[row]]; }
+const std::string& Task4_MatchTable::statusName(int row) const { return status_dict[status_codes[row]]; }
+bool Task4_MatchTable::isCompleted(int row) const { return completed_code != -1 && status_codes[row] == completed_code; }
+bool Task4_MatchTable::hasScore(int row) const { return scores[row] != NO_SCORE; }
+int Task4_MatchTable::score1(int row) const { return hasScore(row) ? (int)(scores[row] >> 16) : 0; }
+int Task4_MatchTable::score2(int row) const { return hasScore(row) ? (int)(scores[row] & 0xFFFFu) : 0; }
+long long Task4_MatchTable::scheduledAt(int row) const { return scheduled_times[row]; }
+
+std::string Task4_MatchTable::scoreText(int row) const {
+    if (!hasScore(row)) return "";
+    return std::to_string(score1(row)) + "-" + std::to_string(score2(row));
+}
+
+std::string Task4_MatchTable::scheduledDate(int row) const { return formatEpoch(scheduled_times[row], false); }
+static int task4_formatEpoch(long long epoch_seconds, int format, char* buf);
+
+std::string Task4_MatchTable::scheduledTime(int row) const {
+    char buf[20];
+    return std::string(buf, task4_formatEpoch(scheduled_times[row], time_formats[row], buf));
+}
+
+bool Task4_MatchTable::getRow(int row, Task4_MatchResult& out) const {
+    if (row < 0 || row >= row_count) return false;
+    out = Task4_MatchResult(match_ids[row], stageName(row), group_ids[row], rounds[row], player1_ids[row], player2_ids[row],
+                            scheduledTime(row), statusName(row), winner_ids[row], scoreText(row));
+    return true;
+}
+
+int Task4_MatchTable::rowsForPlayer(int player_id, const int*& rows) const {
+    int slot;
+    if (!posting_slots.find(player_id, slot)) { rows = nullptr; return 0; }
+    rows = postings[slot].rows;
+    return postings[slot].count;
+}
+
+int Task4_MatchTable::countForPlayer(int player_id) const {
+    const int* rows;
+    return rowsForPlayer(player_id, rows);
+}
+
+int Task4_MatchTable::playerCount() const { return posting_count; }
+
+// Rows are read in order and the per-player sums are indexed by posting slot,
+// so the accumulators stay in cache and there is no hashing or parsing per row.
+void Task4_MatchTable::aggregatePlayerTotals(Task4_PlayerTotals* out) const {
+    for (int slot = 0; slot < posting_count; slot++) {
+        out[slot].player_id = postings[slot].player_id;
+        out[slot].matches = out[slot].wins = out[slot].losses = 0;
+        out[slot].score_total = 0;
+    }
+    if (completed_code == -1) return;
+    const uint8_t completed = (uint8_t)completed_code;
+    for (int row = 0; row < row_count; row++) {
+        int winner = winner_ids[row];
+        if (status_codes[row] != completed || winner == 0) continue;
+        uint32_t packed = scores[row] == NO_SCORE ? 0 : scores[row];
+        Task4_PlayerTotals& p1 = out[player1_slots[row]];
+        p1.matches++;
+        p1.score_total += packed >> 16;
+        if (winner == player1_ids[row]) p1.wins++; else p1.losses++;
+        if (player2_slots[row] == player1_slots[row]) continue;
+        Task4_PlayerTotals& p2 = out[player2_slots[row]];
+        p2.matches++;
+        p2.score_total += packed & 0xFFFFu;
+        if (winner == player2_ids[row]) p2.wins++; else p2.losses++;
+    }
+}
+
+// Each set field contributes one bitmap (a date range ORs its days together);
+// the bitmaps are then intersected, smallest first.
+int Task4_MatchTable::select(const Task4_MatchFilter& filter, Task4_Bitmap& out) const {
+    const Task4_Bitmap* parts[5];
+    int part_count = 0;
+    bool impossible = false;
+
+    if (!filter.stage.empty()) {
+        int code = -1;
+        for (int i = 0; i < stage_dict_size; i++) if (stage_dict[i] == filter.stage) code = i;
+        const Task4_Bitmap* b = code == -1 ? nullptr : stage_index.find(code);
+        if (b) parts[part_count++] = b; else impossible = true;
+    }
+    if (!filter.status.empty()) {
+        int code = -1;
+        for (int i = 0; i < status_dict_size; i++) if (status_dict[i] == filter.status) code = i;
+        const Task4_Bitmap* b = code == -1 ? nullptr : status_index.find(code);
+        if (b) parts[part_count++] = b; else impossible = true;
+    }
+    if (filter.round >= 0) {
+        const Task4_Bitmap* b = round_index.find(filter.round);
+        if (b) parts[part_count++] = b; else impossible = true;
+    }
+    if (filter.group_id >= 0) {
+        const Task4_Bitmap* b = group_index.find(filter.group_id);
+        if (b) parts[part_count++] = b; else impossible = true;
+    }
+
+    Task4_Bitmap date_rows;
+    bool has_date = !filter.date_from.empty() || !filter.date_to.empty();
+    if (has_date) {
+        long long from_day = std::numeric_limits<long long>::min();
+        long long to_day = std::numeric_limits<long long>::max();
+        if (!filter.date_from.empty()) from_day = parseScheduledTime(filter.date_from);
+        if (!filter.date_to.empty()) to_day = parseScheduledTime(filter.date_to);
+        if (from_day == -1 || to_day == -1) impossible = true; // unparseable date
+        if (!filter.date_from.empty()) from_day /= 86400;
+        if (!filter.date_to.empty()) to_day /= 86400;
+        // The day directory is sorted, so only the days inside the range are touched
+        int b = from_day < std::numeric_limits<int>::min() ? 0 : findDayBlock((int)from_day);
+        for (; b < day_block_count && day_blocks[b].day <= to_day && !impossible; b++) {
+            date_rows.orWith(*day_index.find(day_blocks[b].day));
+        }
+        parts[part_count++] = &date_rows;
+    }
+
+    out.clear();
+    if (impossible) return 0;
+    if (part_count == 0) {
+        out.addRange(0, row_count);
+        return row_count;
+    }
+    for (int i = 1; i < part_count; i++) { // few parts: insertion sort by size
+        const Task4_Bitmap* p = parts[i];
+        int j = i;
+        while (j > 0 && parts[j - 1]->cardinality() > p->cardinality()) { parts[j] = parts[j - 1]; j--; }
+        parts[j] = p;
+    }
+    out.copyFrom(*parts[0]);
+    for (int i = 1; i < part_count; i++) out.andWith(*parts[i]);
+    return out.cardinality();
+}
+
+// "18-15" -> 18 << 16 | 15. Scores above 65535 or any other text give NO_SCORE.
+uint32_t Task4_MatchTable::packScore(const std::string& score) {
+    size_t i = 0, n = score.size();
+    uint32_t parts[2] = {0, 0};
+    for (int part = 0; part < 2; part++) {
+        size_t start = i;
+        while (i < n && isdigit((unsigned char)score[i])) {
+            parts[part] = parts[part] * 10 + (score[i] - '0');
+            if (parts[part] > 0xFFFFu) return NO_SCORE;
+            i++;
+        }
+        if (i == start) return NO_SCORE;
+        if (part == 0) {
+            if (i >= n || score[i] != '-') return NO_SCORE;
+            i++;
+        }
+    }
+    if (i != n) return NO_SCORE;
+    return (parts[0] << 16) | parts[1];
+}
+
+// Days since 1970-01-01 for a proleptic Gregorian date (Howard Hinnant's days_from_civil).
+static long long task4_daysFromCivil(int y, int m, int d) {
+    y -= m <= 2;
+    long long era = (y >= 0 ? y : y - 399) / 400;
+    long long yoe = y - era * 400;
+    long long doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// "YYYY-MM-DD[ HH:MM[:SS]]" -> epoch seconds, treating the time as UTC.
+long long Task4_MatchTable::parseScheduledTime(const std::string& t) {
+    int y, mo, d, h = 0, mi = 0, s = 0;
+    if (t.size() < 10 || sscanf(t.c_str(), "%4d-%2d-%2d", &y, &mo, &d) != 3) return -1;
+    if (mo < 1 || mo > 12 || d < 1 || d > 31) return -1;
+    if (t.size() > 10) sscanf(t.c_str() + 10, " %2d:%2d:%2d", &h, &mi, &s);
+    return task4_daysFromCivil(y, mo, d) * 86400LL + h * 3600LL + mi * 60LL + s;
+}
+
+// Writes the time in one of the Task4_MatchTable::TIME_* layouts into buf (at least 20 bytes,
+// not terminated). Returns the length, 0 for an unknown time. Digits are produced directly;
+// exports call this per row.
+static int task4_formatEpoch(long long epoch_seconds, int format, char* buf) {
+    if (epoch_seconds < 0 || format == Task4_MatchTable::TIME_UNKNOWN) return 0;
+    long long z = epoch_seconds / 86400 + 719468; // civil_from_days
+    long long secs = epoch_seconds % 86400;
+    long long era = z / 146097;
+    long long doe = z - era * 146097;
+    long long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    long long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    long long mp = (5 * doy + 2) / 153;
+    int d = (int)(doy - (153 * mp + 2) / 5 + 1);
+    int m = (int)(mp < 10 ? mp + 3 : mp - 9);
+    int y = (int)(yoe + era * 400 + (m <= 2));
+    int fields[6] = {y, m, d, (int)(secs / 3600), (int)(secs / 60 % 60), (int)(secs % 60)};
+    const char separators[6] = {'-', '-', ' ', ':', ':', '\0'};
+    int n = 0;
+    buf[n++] = (char)('0' + y / 1000 % 10); buf[n++] = (char)('0' + y / 100 % 10);
+    buf[n++] = (char)('0' + y / 10 % 10);   buf[n++] = (char)('0' + y % 10);
+    int last = format == Task4_MatchTable::TIME_SECONDS ? 5 : (format == Task4_MatchTable::TIME_MINUTES ? 4 : 2);
+    for (int i = 1; i <= last; i++) {
+        buf[n++] = separators[i - 1];
+        buf[n++] = (char)('0' + fields[i] / 10 % 10);
+        buf[n++] = (char)('0' + fields[i] % 10);
+    }
+    return n;
+}
+
+std::string Task4_MatchTable::formatEpoch(long long epoch_seconds, bool with_time) {
+    char buf[20];
+    return std::string(buf, task4_formatEpoch(epoch_seconds, with_time ? TIME_SECONDS : TIME_DATE, buf));
+}
+
+uint8_t Task4_MatchTable::timeFormatOf(const std::string& t) {
+    if (t.empty()) return TIME_UNKNOWN;
+    return t.size() <= 10 ? TIME_DATE : (t.size() <= 16 ? TIME_MINUTES : TIME_SECONDS);
+}
+
+// The columns are narrower than the CSV text, so a row is only taken when writing
+// it back out gives exactly what came in.
+const char* Task4_MatchTable::rowProblem(int round, const std::string& scheduled_time, const std::string& score) {
+    if (round < 0 || round > 255) return "round is outside 0-255";
+    if (!score.empty()) {
+        uint32_t packed = packScore(score);
+        if (packed == NO_SCORE) return "score is not \"X-Y\" with both sides at most 65535";
+        if (std::to_string(packed >> 16) + "-" + std::to_string(packed & 0xFFFFu) != score) return "score has leading zeros";
+    }
+    if (!scheduled_time.empty()) {
+        char buf[20];
+        long long at = parseScheduledTime(scheduled_time);
+        int n = task4_formatEpoch(at, timeFormatOf(scheduled_time), buf);
+        if (n == 0 || scheduled_time.compare(0, std::string::npos, buf, n) != 0)
+            return "scheduled_time is not YYYY-MM-DD[ HH:MM[:SS]]";
+    }
+    return nullptr;
+}
+
+// matches.csv layout, the same header Tournament::saveMatchesToCSV writes.
+void Task4_MatchTable::writeCSV(BufferedWriter& out) const {
+    char when[20];
+    out.write("match_id,stage,group_id,round,player1_id,player2_id,scheduled_time,status,winner_id,score\n");
+    for (int row = 0; row < row_count; row++) {
+        out.writeInt(match_ids[row]); out.put(',');
+        out.write(stage_dict[stage_codes[row]]); out.put(',');
+        out.writeInt(group_ids[row]); out.put(',');
+        out.writeInt(rounds[row]); out.put(',');
+        out.writeInt(player1_ids[row]); out.put(',');
+        out.writeInt(player2_ids[row]); out.put(',');
+        out.write(when, task4_formatEpoch(scheduled_times[row], time_formats[row], when)); out.put(',');
+        out.write(status_dict[status_codes[row]]); out.put(',');
+        out.writeInt(winner_ids[row]); out.put(',');
+        if (scores[row] != NO_SCORE) { out.writeInt(scores[row] >> 16); out.put('-'); out.writeInt(scores[row] & 0xFFFFu); }
+        out.put('\n');
+    }
+}
+
+// One JSON object per line; unknown times and scores are null.
+void Task4_MatchTable::writeJSONLines(BufferedWriter& out) const {
+    char when[20];
+    for (int row = 0; row < row_count; row++) {
+        out.write("{\"match_id\":"); out.writeInt(match_ids[row]);
+        out.write(",\"stage\":"); out.writeJsonString(stage_dict[stage_codes[row]].c_str());
+        out.write(",\"group_id\":"); out.writeInt(group_ids[row]);
+        out.write(",\"round\":"); out.writeInt(rounds[row]);
+        out.write(",\"player1_id\":"); out.writeInt(player1_ids[row]);
+        out.write(",\"player2_id\":"); out.writeInt(player2_ids[row]);
+        out.write(",\"scheduled_time\":");
+        int n = task4_formatEpoch(scheduled_times[row], time_formats[row], when);
+        if (n > 0) { out.put('"'); out.write(when, n); out.put('"'); } else out.write("null");
+        out.write(",\"status\":"); out.writeJsonString(status_dict[status_codes[row]].c_str());
+        out.write(",\"winner_id\":"); out.writeInt(winner_ids[row]);
+        out.write(",\"score\":");
+        if (scores[row] != NO_SCORE) {
+            out.write("["); out.writeInt(scores[row] >> 16); out.put(','); out.writeInt(scores[row] & 0xFFFFu); out.put(']');
+        } else out.write("null");
+        out.write("}\n");
+    }
+}
+
+// Parquet-like layout: "APUECCOL", then row groups of ROW_GROUP_ROWS rows, each holding
+// one raw chunk per column (stage/status as dictionary codes). A JSON footer lists every
+// chunk's offset and size plus the dictionaries, followed by its uint32 length and the magic
+// again, so readers can fetch just the columns and row groups they need.
+void Task4_MatchTable::writeColumnar(BufferedWriter& out) const {
+    static const int ROW_GROUP_ROWS = 65536;
+    struct Column { const char* name; const char* type; const void* data; int width; };
+    const Column columns[] = {
+        {"match_id", "int32", match_ids, 4},       {"stage", "dict8", stage_codes, 1},
+        {"group_id", "int32", group_ids, 4},       {"round", "uint8", rounds, 1},
+        {"player1_id", "int32", player1_ids, 4},   {"player2_id", "int32", player2_ids, 4},
+        {"scheduled_time", "int64", scheduled_times, 8}, {"status", "dict8", status_codes, 1},
+        {"winner_id", "int32", winner_ids, 4},     {"score", "uint32", scores, 4},
+        {"time_format", "uint8", time_formats, 1},
+    };
+    const int column_count = (int)(sizeof(columns) / sizeof(columns[0]));
+    int groups = (row_count + ROW_GROUP_ROWS - 1) / ROW_GROUP_ROWS;
+    long long* offsets = task4_newArray<long long>((size_t)column_count * (groups > 0 ? groups : 1));
+
+    long long start = out.bytesWritten();
+    out.write("APUECCOL", 8);
+    for (int g = 0; g < groups; g++) {
+        int first = g * ROW_GROUP_ROWS;
+        int rows = row_count - first < ROW_GROUP_ROWS ? row_count - first : ROW_GROUP_ROWS;
+        for (int c = 0; c < column_count; c++) {
+            offsets[(size_t)c * groups + g] = out.bytesWritten() - start;
+            out.write((const char*)columns[c].data + (size_t)first * columns[c].width, (size_t)rows * columns[c].width);
+        }
+    }
+
+    long long footer_start = out.bytesWritten();
+    out.write("{\"format\":\"apuec-columnar\",\"version\":1,\"rows\":"); out.writeInt(row_count);
+    out.write(",\"row_group_rows\":"); out.writeInt(ROW_GROUP_ROWS);
+    out.write(",\"byte_order\":\"host\",\"columns\":[");
+    for (int c = 0; c < column_count; c++) {
+        if (c > 0) out.put(',');
+        out.write("{\"name\":"); out.writeJsonString(columns[c].name);
+        out.write(",\"type\":"); out.writeJsonString(columns[c].type);
+        out.write(",\"chunks\":[");
+        for (int g = 0; g < groups; g++) {
+            int rows = row_count - g * ROW_GROUP_ROWS < ROW_GROUP_ROWS ? row_count - g * ROW_GROUP_ROWS : ROW_GROUP_ROWS;
+            if (g > 0) out.put(',');
+            out.put('['); out.writeInt(offsets[(size_t)c * groups + g]); out.put(','); out.writeInt((long long)rows * columns[c].width); out.put(']');
+        }
+        out.write("]}");
+    }
+    out.write("],\"dictionaries\":{\"stage\":[");
+    for (int i = 0; i < stage_dict_size; i++) { if (i > 0) out.put(','); out.writeJsonString(stage_dict[i].c_str()); }
+    out.write("],\"status\":[");
+    for (int i = 0; i < status_dict_size; i++) { if (i > 0) out.put(','); out.writeJsonString(status_dict[i].c_str()); }
+    out.write("]},\"missing\":{\"scheduled_time\":-1,\"score\":4294967295}}");
+    uint32_t footer_bytes = (uint32_t)(out.bytesWritten() - footer_start);
+    out.write(&footer_bytes, 4);
+    out.write("APUECCOL", 8);
+    task4_deleteArray(offsets);
+}
+
+// Task4_Leaderboard implementations
+Task4_Leaderboard::Task4_Leaderboard() : nodes(nullptr), capacity(0), root(-1) {}
+
+Task4_Leaderboard::~Task4_Leaderboard() {
+    task4_deleteArray(nodes);
+}
+
+void Task4_Leaderboard::clear() {
+    for (int i = 0; i < capacity; i++) nodes[i].linked = false;
+    root = -1;
+}
+
+void Task4_Leaderboard::ensureSlot(int slot) {
+    if (slot < capacity) return;
+    int new_capacity = capacity == 0 ? 64 : capacity;
+    while (new_capacity <= slot) new_capacity *= 2;
+    Node* grown = task4_newArray<Node>(new_capacity);
+    for (int i = 0; i < capacity; i++) grown[i] = nodes[i];
+    for (int i = capacity; i < new_capacity; i++) {
+        unsigned int h = (unsigned int)(i + 1) * 2654435761u; // Fixed per slot, so runs are reproducible
+        h ^= h >> 16;
+        h *= 0x45d9f3bu;
+        h ^= h >> 16;
+        grown[i].priority = h;
+        grown[i].linked = false;
+    }
+    task4_deleteArray(nodes);
+    nodes = grown;
+    capacity = new_capacity;
+}
+
+bool Task4_Leaderboard::before(int a, int b) const {
+    const Node& x = nodes[a];
+    const Node& y = nodes[b];
+    if ((x.matches > 0) != (y.matches > 0)) return x.matches > 0; // Unplayed players rank last
+    if (x.matches > 0) {
+        long long x_rate = (long long)x.wins * y.matches; // x.wins / x.matches vs y.wins / y.matches
+        long long y_rate = (long long)y.wins * x.matches;
+        if (x_rate != y_rate) return x_rate > y_rate;
+        if (x.wins != y.wins) return x.wins > y.wins;
+        // Average score: whole part first, then the remainders cross-multiplied, which cannot overflow
+        long long x_whole = x.score_total / x.matches, y_whole = y.score_total / y.matches;
+        if (x_whole != y_whole) return x_whole > y_whole;
+        long long x_rest = (x.score_total % x.matches) * y.matches;
+        long long y_rest = (y.score_total % y.matches) * x.matches;
+        if (x_rest != y_rest) return x_rest > y_rest;
+    }
+    if (x.player_id != y.player_id) return x.player_id < y.player_id;
+    return a < b;
+}
+
+int Task4_Leaderboard::subtreeSize(int node) const {
+    return node == -1 ? 0 : nodes[node].size;
+}
+
+void Task4_Leaderboard::pull(int node) {
+    nodes[node].size = 1 + subtreeSize(nodes[node].left) + subtreeSize(nodes[node].right);
+}
+
+void Task4_Leaderboard::split(int node, int key_slot, int& left_out, int& right_out) {
+    if (node == -1) { left_out = right_out = -1; return; }
+    if (before(node, key_slot)) {
+        split(nodes[node].right, key_slot, nodes[node].right, right_out);
+        left_out = node;
+    } else {
+        split(nodes[node].left, key_slot, left_out, nodes[node].left);
+        right_out = node;
+    }
+    pull(node);
+}
+
+int Task4_Leaderboard::merge(int left, int right) {
+    if (left == -1) return right;
+    if (right == -1) return left;
+    if (nodes[left].priority > nodes[right].priority) {
+        nodes[left].right = merge(nodes[left].right, right);
+        pull(left);
+        return left;
+    }
+    nodes[right].left = merge(left, nodes[right].left);
+    pull(right);
+    return right;
+}
+
+// Removes slot from the subtree rooted at node, using the key the slot was inserted with.
+int Task4_Leaderboard::unlink(int node, int slot) {
+    if (node == -1) return -1;
+    if (node == slot) return merge(nodes[node].left, nodes[node].right);
+    if (before(slot, node)) nodes[node].left = unlink(nodes[node].left, slot);
+    else nodes[node].right = unlink(nodes[node].right, slot);
+    pull(node);
+    return node;
+}
+
+void Task4_Leaderboard::update(int slot, int player_id, int matches, int wins, long long score_total) {
+    if (slot < 0) return;
+    ensureSlot(slot);
+    if (nodes[slot].linked) root = unlink(root, slot);
+    Node& n = nodes[slot];
+    n.player_id = player_id;
+    n.matches = matches;
+    n.wins = wins;
+    n.score_total = score_total;
+    n.left = n.right = -1;
+    n.size = 1;
+    n.linked = true;
+    int left, right;
+    split(root, slot, left, right);
+    root = merge(merge(left, slot), right);
+}
+
+void Task4_Leaderboard::remove(int slot) {
+    if (slot < 0 || slot >= capacity || !nodes[slot].linked) return;
+    root = unlink(root, slot);
+    nodes[slot].linked = false;
+}
+
+int Task4_Leaderboard::size() const { return subtreeSize(root); }
+
+int Task4_Leaderboard::rankOf(int slot) const {
+    if (slot < 0 || slot >= capacity || !nodes[slot].linked) return -1;
+    int rank = 0;
+    int node = root;
+    while (node != -1) {
+        if (node == slot) return rank + subtreeSize(nodes[node].left) + 1;
+        if (before(slot, node)) {
+            node = nodes[node].left;
+        } else {
+            rank += subtreeSize(nodes[node].left) + 1;
+            node = nodes[node].right;
+        }
+    }
+    return -1;
+}
+
+// In-order walk that skips every subtree lying wholly outside [first_rank, last_rank].
+int Task4_Leaderboard::collect(int node, int skip, int first_rank, int last_rank, int* slots_out, int written) const {
+    if (node == -1 || skip + nodes[node].size < first_rank || skip + 1 > last_rank) return written;
+    int left_size = subtreeSize(nodes[node].left);
+    written = collect(nodes[node].left, skip, first_rank, last_rank, slots_out, written);
+    int rank = skip + left_size + 1;
+    if (rank >= first_rank && rank <= last_rank) slots_out[written++] = node;
+    return collect(nodes[node].right, rank, first_rank, last_rank, slots_out, written);
+}
+
+int Task4_Leaderboard::range(int first_rank, int last_rank, int* slots_out) const {
+    if (first_rank < 1) first_rank = 1;
+    if (last_rank > size()) last_rank = size();
+    if (first_rank > last_rank) return 0;
+    return collect(root, 0, first_rank, last_rank, slots_out, 0);
+}
+
+// Task4_HeadToHead implementations
+Task4_HeadToHead::Task4_HeadToHead()
+    : keys(nullptr), slots(nullptr), used(nullptr), table_capacity(0),
+      records(nullptr), record_count(0), record_capacity(0),
+      rivals(nullptr), rival_count(0), rival_capacity(0) {}
+
+Task4_HeadToHead::~Task4_HeadToHead() {
+    clear();
+    task4_deleteArray(keys);
+    task4_deleteArray(slots);
+    task4_deleteArray(used);
+    task4_deleteArray(records);
+    task4_deleteArray(rivals);
+}
+
+void Task4_HeadToHead::clear() {
+    if (used) memset(used, 0, table_capacity);
+    record_count = 0;
+    for (int i = 0; i < rival_count; i++) task4_deleteArray(rivals[i].records);
+    rival_count = 0;
+    rival_slots.clear();
+}
+
+uint64_t Task4_HeadToHead::pairKey(int player_a, int player_b) {
+    int low = player_a < player_b ? player_a : player_b;
+    int high = player_a < player_b ? player_b : player_a;
+    return ((uint64_t)(uint32_t)low << 32) | (uint32_t)high;
+}
+
+// Fibonacci hashing; the top bits mix both ids of the pair.
+static inline unsigned int task4_hashPair(uint64_t key) {
+    return (unsigned int)((key * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+int Task4_HeadToHead::findRecord(uint64_t key) const {
+    if (record_count == 0) return -1;
+    unsigned int mask = (unsigned int)table_capacity - 1;
+    for (unsigned int i = task4_hashPair(key) & mask; used[i]; i = (i + 1) & mask) {
+        if (keys[i] == key) return slots[i];
+    }
+    return -1;
+}
+
+void Task4_HeadToHead::rehash(int new_capacity) {
+    uint64_t* old_keys = keys;
+    int* old_slots = slots;
+    unsigned char* old_used = used;
+    int old_capacity = table_capacity;
+    keys = task4_newArray<uint64_t>(new_capacity);
+    slots = task4_newArray<int>(new_capacity);
+    used = task4_newArray<unsigned char>(new_capacity);
+    memset(used, 0, new_capacity);
+    table_capacity = new_capacity;
+    unsigned int mask = (unsigned int)new_capacity - 1;
+    for (int i = 0; i < old_capacity; i++) {
+        if (!old_used[i]) continue;
+        unsigned int j = task4_hashPair(old_keys[i]) & mask;
+        while (used[j]) j = (j + 1) & mask;
+        used[j] = 1; keys[j] = old_keys[i]; slots[j] = old_slots[i];
+    }
+    task4_deleteArray(old_keys);
+    task4_deleteArray(old_slots);
+    task4_deleteArray(old_used);
+}
+
+void Task4_HeadToHead::addRival(int player_id, int record) {
+    int slot;
+    if (!rival_slots.find(player_id, slot)) {
+        if (rival_count == rival_capacity) {
+            rival_capacity = rival_capacity > 0 ? rival_capacity * 2 : 64;
+            rivals = task4_resizeColumn(rivals, rival_count, rival_capacity);
+        }
+        slot = rival_count++;
+        rivals[slot].records = nullptr;
+        rivals[slot].count = rivals[slot].capacity = 0;
+        rival_slots.put(player_id, slot);
+    }
+    RivalList& list = rivals[slot];
+    if (list.count == list.capacity) {
+        list.capacity = list.capacity > 0 ? list.capacity * 2 : 4;
+        list.records = task4_resizeColumn(list.records, list.count, list.capacity);
+    }
+    list.records[list.count++] = record;
+}
+
+int Task4_HeadToHead::recordFor(int player_a, int player_b) {
+    uint64_t key = pairKey(player_a, player_b);
+    int record = findRecord(key);
+    if (record != -1) return record;
+
+    if ((record_count + 1) * 2 > table_capacity) rehash(table_capacity > 0 ? table_capacity * 2 : 64); // load factor <= 0.5
+    if (record_count == record_capacity) {
+        record_capacity = record_capacity > 0 ? record_capacity * 2 : 64;
+        records = task4_resizeColumn(records, record_count, record_capacity);
+    }
+    record = record_count++;
+    Task4_HeadToHeadRecord& r = records[record];
+    r.low_id = player_a < player_b ? player_a : player_b;
+    r.high_id = player_a < player_b ? player_b : player_a;
+    r.matches = r.low_wins = r.high_wins = 0;
+    r.last_row = -1;
+
+    unsigned int mask = (unsigned int)table_capacity - 1;
+    unsigned int i = task4_hashPair(key) & mask;
+    while (used[i]) i = (i + 1) & mask;
+    used[i] = 1; keys[i] = key; slots[i] = record;
+
+    addRival(r.low_id, record);
+    if (r.high_id != r.low_id) addRival(r.high_id, record);
+    return record;
+}
+
+void Task4_HeadToHead::applyRow(const Task4_MatchTable& table, int row, int direction) {
+    int winner = table.winnerId(row);
+    if (!table.isCompleted(row) || winner == 0) return; // Same rule as the player stats
+    int p1 = table.player1Id(row);
+    int p2 = table.player2Id(row);
+    if (p1 == p2) return;
+    int record = recordFor(p1, p2); // May grow records, so index only afterwards
+    Task4_HeadToHeadRecord& r = records[record];
+    r.matches += direction;
+    if (winner == r.low_id) r.low_wins += direction;
+    else if (winner == r.high_id) r.high_wins += direction;
+    if (direction > 0 && row > r.last_row) r.last_row = row;
+}
+
+void Task4_HeadToHead::build(const Task4_MatchTable& table) {
+    clear();
+    int rows = table.size();
+    for (int row = 0; row < rows; row++) applyRow(table, row, 1);
+}
+
+const Task4_HeadToHeadRecord* Task4_HeadToHead::find(int player_a, int player_b) const {
+    int record = findRecord(pairKey(player_a, player_b));
+    return record == -1 ? nullptr : &records[record];
+}
+
+int Task4_HeadToHead::topRivals(int player_id, int max_count, const Task4_HeadToHeadRecord** out) const {
+    int slot;
+    if (max_count <= 0 || !rival_slots.find(player_id, slot)) return 0;
+    const RivalList& list = rivals[slot];
+    int found = 0;
+    // Insertion into a bounded, sorted output; max_count is small next to a player's opponent count
+    for (int i = 0; i < list.count; i++) {
+        const Task4_HeadToHeadRecord* r = &records[list.records[i]];
+        if (r->matches <= 0) continue;
+        int pos = found < max_count ? found : max_count;
+        while (pos > 0 && (out[pos - 1]->matches < r->matches ||
+                           (out[pos - 1]->matches == r->matches && out[pos - 1]->last_row < r->last_row))) {
+            if (pos < max_count) out[pos] = out[pos - 1];
+            pos--;
+        }
+        if (pos < max_count) {
+            out[pos] = r;
+            if (found < max_count) found++;
+        }
+    }
+    return found;
+}
+
+int Task4_HeadToHead::pairCount() const { return record_count; }
+
+// Task4_RollingForm implementations
+Task4_RollingForm::Task4_RollingForm(int days)
+    : buckets(nullptr), slot_capacity(0), window_days(days > 0 ? days : 1), last_day(-1), last_day_results(0) {}
+
+Task4_RollingForm::~Task4_RollingForm() {
+    task4_deleteArray(buckets);
+}
+
+void Task4_RollingForm::clear() {
+    for (int i = 0; i < slot_capacity * window_days; i++) buckets[i].day = -1;
+    last_day = -1;
+    last_day_results = 0;
+}
+
+void Task4_RollingForm::ensureSlot(int slot) {
+    if (slot < slot_capacity) return;
+    int new_capacity = slot_capacity > 0 ? slot_capacity : 64;
+    while (new_capacity <= slot) new_capacity *= 2;
+    Bucket* grown = task4_newArray<Bucket>(new_capacity * window_days);
+    for (int i = 0; i < slot_capacity * window_days; i++) grown[i] = buckets[i];
+    for (int i = slot_capacity * window_days; i < new_capacity * window_days; i++) grown[i].day = -1;
+    task4_deleteArray(buckets);
+    buckets = grown;
+    slot_capacity = new_capacity;
+}
+
+void Task4_RollingForm::apply(int slot, int day, bool is_winner, int direction) {
+    if (slot < 0 || day < 0) return;
+    ensureSlot(slot);
+    if (direction > 0 && day > last_day) { // Older buckets drop out of the window on their own
+        last_day = day;
+        last_day_results = 0;
+    }
+    if (day <= last_day - window_days) return;
+    Bucket& b = buckets[slot * window_days + day % window_days];
+    if (b.day != day) {
+        if (direction < 0) return; // The bucket was already reused for a newer day
+        b.day = day;
+        b.matches = b.wins = 0;
+    }
+    b.matches += direction;
+    if (is_winner) b.wins += direction;
+    if (day == last_day) last_day_results += direction;
+}
+
+void Task4_RollingForm::summary(int slot, int& matches, int& wins) const {
+    matches = wins = 0;
+    if (slot < 0 || slot >= slot_capacity) return;
+    const Bucket* b = buckets + slot * window_days;
+    for (int i = 0; i < window_days; i++) {
+        if (b[i].day > last_day - window_days && b[i].day <= last_day) {
+            matches += b[i].matches;
+            wins += b[i].wins;
+        }
+    }
+}
+
+int Task4_RollingForm::windowDays() const { return window_days; }
+int Task4_RollingForm::lastDay() const { return last_day; }
+bool Task4_RollingForm::needsRebuild() const { return last_day != -1 && last_day_results <= 0; }
+
+// Task4_Snapshot implementations
+// File:    "APUECSNP" | uint32 version | uint32 reserved
+// Segment: "SEAS" | season_id | rows | players | string_bytes | uint16 stage_count | uint16 status_count
+//          | uint64 payload_bytes | uint64 checksum, then the payload laid out by task4_snapshotLayout.
+static const char TASK4_SNAPSHOT_MAGIC[8] = {'A', 'P', 'U', 'E', 'C', 'S', 'N', 'P'};
+static const char TASK4_SEGMENT_TAG[4] = {'S', 'E', 'A', 'S'};
+static const size_t TASK4_FILE_HEADER_BYTES = 16;
+static const size_t TASK4_SEGMENT_HEADER_BYTES = 40;
+
+struct Task4_SnapshotLayout {
+    size_t scheduled_times, match_ids, group_ids, player1_ids, player2_ids, winner_ids, scores;
+    size_t rounds, stage_codes, status_codes, time_formats, player_ids, player_strings, name_offsets, strings;
+    size_t total;
+};
+
+static size_t task4_pad8(size_t n) { return (n + 7) & ~(size_t)7; }
+
+// Byte offsets of every section in a segment payload; each section starts 8-byte aligned.
+// Version 1 segments have no time_formats section (it is left empty).
+static void task4_snapshotLayout(uint32_t version, size_t rows, size_t players, size_t names, size_t string_bytes,
+                                 Task4_SnapshotLayout& l) {
+    size_t at = 0;
+    l.scheduled_times = at; at += task4_pad8(8 * rows);
+    l.match_ids = at;       at += task4_pad8(4 * rows);
+    l.group_ids = at;       at += task4_pad8(4 * rows);
+    l.player1_ids = at;     at += task4_pad8(4 * rows);
+    l.player2_ids = at;     at += task4_pad8(4 * rows);
+    l.winner_ids = at;      at += task4_pad8(4 * rows);
+    l.scores = at;          at += task4_pad8(4 * rows);
+    l.rounds = at;          at += task4_pad8(rows);
+    l.stage_codes = at;     at += task4_pad8(rows);
+    l.status_codes = at;    at += task4_pad8(rows);
+    l.time_formats = at;    at += version >= 2 ? task4_pad8(rows) : 0;
+    l.player_ids = at;      at += task4_pad8(4 * players);
+    l.player_strings = at;  at += task4_pad8(4 * 4 * players); // name, rank, contact, registration offsets
+    l.name_offsets = at;    at += task4_pad8(4 * names);       // stage names then status names
+    l.strings = at;         at += task4_pad8(string_bytes);
+    l.total = at;
+}
+
+static uint64_t task4_fnv1a64(const unsigned char* bytes, size_t n) {
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < n; i++) { h ^= bytes[i]; h *= 1099511628211ull; }
+    return h;
+}
+
+Task4_Snapshot::Task4_Snapshot()
+    : data(nullptr), data_size(0), version(0), mapped(false), owned_buffer(nullptr), segments(nullptr), segment_count(0),
+      valid_size(0) {}
+
+Task4_Snapshot::~Task4_Snapshot() {
+    close();
+}
+
+void Task4_Snapshot::close() {
+#if !defined(_WIN32)
+    if (mapped && data) munmap((void*)data, data_size);
+#endif
+    task4_deleteArray(owned_buffer);
+    owned_buffer = nullptr;
+    task4_deleteArray(segments);
+    segments = nullptr;
+    segment_count = 0;
+    data = nullptr;
+    data_size = 0;
+    version = 0;
+    mapped = false;
+    valid_size = 0;
+}
+
+bool Task4_Snapshot::open(const std::string& path) {
+    close();
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { std::cerr << "Task 4 Warning: Cannot open snapshot '" << path << "'." << std::endl; return false; }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            data = (const unsigned char*)map;
+            data_size = (size_t)st.st_size;
+            mapped = true;
+        }
+    }
+    ::close(fd);
+#endif
+    if (!data) { // Windows, or mmap refused: read the file into an 8-byte aligned buffer
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) { std::cerr << "Task 4 Warning: Cannot open snapshot '" << path << "'." << std::endl; return false; }
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        if (size > 0) {
+            owned_buffer = task4_newArray<uint64_t>(((size_t)size + 7) / 8);
+            if (fread(owned_buffer, 1, (size_t)size, f) == (size_t)size) {
+                data = (const unsigned char*)owned_buffer;
+                data_size = (size_t)size;
+            }
+        }
+        fclose(f);
+    }
+    if (data_size < TASK4_FILE_HEADER_BYTES && (data_size == 0 || memcmp(data, TASK4_SNAPSHOT_MAGIC, data_size < 8 ? data_size : 8) == 0)) {
+        std::cerr << "Task 4 Warning: Snapshot '" << path << "' holds only a partial file header; it is rewritten on the next save." << std::endl;
+        return true; // Empty, with the whole file as a torn tail
+    }
+    if (data_size < TASK4_FILE_HEADER_BYTES || memcmp(data, TASK4_SNAPSHOT_MAGIC, 8) != 0) {
+        std::cerr << "Task 4 Warning: '" << path << "' is not a match snapshot." << std::endl;
+        close();
+        return false;
+    }
+    memcpy(&version, data + 8, 4);
+    if (version < 1 || version > VERSION) {
+        std::cerr << "Task 4 Warning: Snapshot version " << version << " is not supported (expected " << VERSION << ")." << std::endl;
+        close();
+        return false;
+    }
+
+    // Walk the segment chain once, checking bounds and checksums before anything is read from it
+    int capacity = 8;
+    segments = task4_newArray<Segment>(capacity);
+    size_t at = TASK4_FILE_HEADER_BYTES;
+    bool torn = false;
+    while (at < data_size) {
+        const unsigned char* h = data + at;
+        if (data_size - at < TASK4_SEGMENT_HEADER_BYTES) { torn = true; break; }
+        if (memcmp(h, TASK4_SEGMENT_TAG, 4) != 0) {
+            std::cerr << "Task 4 Warning: Snapshot segment " << segment_count + 1 << " has a damaged header." << std::endl;
+            close();
+            return false;
+        }
+        Segment seg;
+        uint64_t payload_bytes, checksum;
+        memcpy(&seg.season_id, h + 4, 4);
+        memcpy(&seg.rows, h + 8, 4);
+        memcpy(&seg.players, h + 12, 4);
+        memcpy(&seg.string_bytes, h + 16, 4);
+        memcpy(&seg.stage_count, h + 20, 2);
+        memcpy(&seg.status_count, h + 22, 2);
+        memcpy(&payload_bytes, h + 24, 8);
+        memcpy(&checksum, h + 32, 8);
+        seg.payload = h + TASK4_SEGMENT_HEADER_BYTES;
+        Task4_SnapshotLayout l;
+        task4_snapshotLayout(version, seg.rows, seg.players, (size_t)seg.stage_count + seg.status_count, seg.string_bytes, l);
+        if (payload_bytes == l.total && payload_bytes > data_size - at - TASK4_SEGMENT_HEADER_BYTES) { // Cut short mid-append
+            torn = true;
+            break;
+        }
+        bool ok = payload_bytes == l.total && payload_bytes <= data_size - at - TASK4_SEGMENT_HEADER_BYTES
+                  && seg.stage_count <= TASK4_MAX_CODES && seg.status_count <= TASK4_MAX_CODES
+                  && task4_fnv1a64(seg.payload, (size_t)payload_bytes) == checksum;
+        if (ok && seg.string_bytes > 0) ok = seg.payload[l.strings + seg.string_bytes - 1] == '\0';
+        if (ok) { // Every string offset and dictionary code must land inside the segment
+            const uint32_t* offsets = (const uint32_t*)(seg.payload + l.player_strings);
+            for (size_t i = 0; ok && i < 4 * (size_t)seg.players; i++) ok = offsets[i] < seg.string_bytes;
+            offsets = (const uint32_t*)(seg.payload + l.name_offsets);
+            for (size_t i = 0; ok && i < (size_t)seg.stage_count + seg.status_count; i++) ok = offsets[i] < seg.string_bytes;
+            const uint8_t* stage = seg.payload + l.stage_codes;
+            const uint8_t* status = seg.payload + l.status_codes;
+            for (size_t i = 0; ok && i < seg.rows; i++) ok = stage[i] < seg.stage_count && status[i] < seg.status_count;
+            const uint8_t* formats = seg.payload + l.time_formats;
+            for (size_t i = 0; ok && version >= 2 && i < seg.rows; i++) ok = formats[i] <= Task4_MatchTable::TIME_SECONDS;
+        }
+        if (!ok && payload_bytes == data_size - at - TASK4_SEGMENT_HEADER_BYTES) { torn = true; break; } // Last one, not fully written
+        if (!ok) {
+            std::cerr << "Task 4 Warning: Snapshot season " << seg.season_id << " failed validation (truncated or checksum mismatch)." << std::endl;
+            close();
+            return false;
+        }
+        if (segment_count == capacity) {
+            capacity *= 2;
+            segments = task4_resizeColumn(segments, segment_count, capacity);
+        }
+        segments[segment_count++] = seg;
+        at += TASK4_SEGMENT_HEADER_BYTES + (size_t)payload_bytes;
+    }
+    valid_size = at;
+    if (torn) {
+        std::cerr << "Task 4 Warning: Snapshot '" << path << "' ends in an incomplete season after " << segment_count
+                  << " valid one(s); it is ignored and cut off on the next save." << std::endl;
+    }
+    return true;
+}
+
+bool Task4_Snapshot::hasTornTail() const { return valid_size < data_size; }
+
+bool Task4_Snapshot::dropTornTail(const std::string& path) {
+    size_t keep = valid_size;
+    bool torn = hasTornTail();
+    close(); // The mapping must not outlive the bytes it covers
+    if (!torn) return true;
+#if defined(_WIN32)
+    int fd = _open(path.c_str(), _O_RDWR | _O_BINARY);
+    bool ok = fd >= 0 && _chsize_s(fd, (__int64)keep) == 0;
+    if (fd >= 0) _close(fd);
+#else
+    bool ok = truncate(path.c_str(), (off_t)keep) == 0;
+#endif
+    if (!ok) std::cerr << "Task 4 Warning: Could not cut the incomplete season off '" << path << "'." << std::endl;
+    return ok;
+}
+
+int Task4_Snapshot::seasonCount() const { return segment_count; }
+int Task4_Snapshot::seasonId(int season) const { return (int)segments[season].season_id; }
+int Task4_Snapshot::seasonRows(int season) const { return (int)segments[season].rows; }
+int Task4_Snapshot::seasonPlayerCount(int season) const { return (int)segments[season].players; }
+
+void Task4_Snapshot::seasonColumns(int season, Task4_ColumnView& out, std::string* names) const {
+    const Segment& seg = segments[season];
+    Task4_SnapshotLayout l;
+    task4_snapshotLayout(version, seg.rows, seg.players, (size_t)seg.stage_count + seg.status_count, seg.string_bytes, l);
+    const unsigned char* p = seg.payload;
+    out.rows = (int)seg.rows;
+    out.scheduled_times = (const int64_t*)(p + l.scheduled_times);
+    out.match_ids = (const int32_t*)(p + l.match_ids);
+    out.group_ids = (const int32_t*)(p + l.group_ids);
+    out.player1_ids = (const int32_t*)(p + l.player1_ids);
+    out.player2_ids = (const int32_t*)(p + l.player2_ids);
+    out.winner_ids = (const int32_t*)(p + l.winner_ids);
+    out.scores = (const uint32_t*)(p + l.scores);
+    out.rounds = p + l.rounds;
+    out.stage_codes = p + l.stage_codes;
+    out.status_codes = p + l.status_codes;
+    out.time_formats = version >= 2 ? p + l.time_formats : nullptr;
+    const uint32_t* offsets = (const uint32_t*)(p + l.name_offsets);
+    const char* strings = (const char*)(p + l.strings);
+    for (int i = 0; i < seg.stage_count + seg.status_count; i++) names[i] = strings + offsets[i];
+    out.stage_names = names;
+    out.stage_name_count = seg.stage_count;
+    out.status_names = names + seg.stage_count;
+    out.status_name_count = seg.status_count;
+}
+
+Task4_SnapshotPlayer Task4_Snapshot::seasonPlayer(int season, int index) const {
+    const Segment& seg = segments[season];
+    Task4_SnapshotLayout l;
+    task4_snapshotLayout(version, seg.rows, seg.players, (size_t)seg.stage_count + seg.status_count, seg.string_bytes, l);
+    const uint32_t* offsets = (const uint32_t*)(seg.payload + l.player_strings) + 4 * index;
+    const char* strings = (const char*)(seg.payload + l.strings);
+    Task4_SnapshotPlayer player;
+    player.player_id = ((const int32_t*)(seg.payload + l.player_ids))[index];
+    player.name = strings + offsets[0];
+    player.rank = strings + offsets[1];
+    player.contact = strings + offsets[2];
+    player.registration = strings + offsets[3];
+    return player;
+}
+
+// Interns s into the string table being built and returns its offset. seen maps a
+// hash of the text to the offset of its first copy; a collision moves on to the next key.
+static uint32_t task4_internString(std::string& table, Task4_IntIndex& seen, const std::string& s) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < s.size(); i++) { h ^= (unsigned char)s[i]; h *= 16777619u; }
+    for (int key = (int)(h & 0x7FFFFFFF); ; key = (key + 1) & 0x7FFFFFFF) {
+        int offset;
+        if (!seen.find(key, offset)) {
+            offset = (int)table.size();
+            table.append(s.c_str(), strlen(s.c_str()) + 1); // Keeps the terminator, stops at an embedded NUL
+            seen.put(key, offset);
+            return (uint32_t)offset;
+        }
+        if (strcmp(table.c_str() + offset, s.c_str()) == 0) return (uint32_t)offset;
+    }
+}
+
+bool Task4_Snapshot::appendSeason(const std::string& path, int season_id, const Task4_ColumnView& matches,
+                                  const Task4_PlayerStats* players, int player_count) {
+    if (matches.stage_name_count > TASK4_MAX_CODES || matches.status_name_count > TASK4_MAX_CODES) return false;
+    size_t rows = matches.rows > 0 ? (size_t)matches.rows : 0;
+    size_t pc = player_count > 0 ? (size_t)player_count : 0;
+    size_t names = (size_t)matches.stage_name_count + matches.status_name_count;
+
+    std::string strings;
+    Task4_IntIndex seen;
+    uint32_t* player_strings = task4_newArray<uint32_t>(4 * pc + 1);
+    uint32_t* name_offsets = task4_newArray<uint32_t>(names + 1);
+    for (size_t i = 0; i < pc; i++) {
+        player_strings[4 * i] = task4_internString(strings, seen, players[i].name);
+        player_strings[4 * i + 1] = task4_internString(strings, seen, players[i].rank);
+        player_strings[4 * i + 2] = task4_internString(strings, seen, players[i].contact);
+        player_strings[4 * i + 3] = task4_internString(strings, seen, players[i].registration_time);
+    }
+    for (int i = 0; i < matches.stage_name_count; i++) name_offsets[i] = task4_internString(strings, seen, matches.stage_names[i]);
+    for (int i = 0; i < matches.status_name_count; i++)
+        name_offsets[matches.stage_name_count + i] = task4_internString(strings, seen, matches.status_names[i]);
+
+    // A segment goes in the layout of the file it joins; a new file gets the current one
+    uint32_t file_version = VERSION;
+    FILE* existing = fopen(path.c_str(), "rb");
+    if (existing) {
+        unsigned char file_header[TASK4_FILE_HEADER_BYTES];
+        if (fread(file_header, 1, sizeof(file_header), existing) == sizeof(file_header)) memcpy(&file_version, file_header + 8, 4);
+        fclose(existing);
+    }
+    Task4_SnapshotLayout l;
+    task4_snapshotLayout(file_version, rows, pc, names, strings.size(), l);
+    unsigned char* payload = task4_newArray<unsigned char>(l.total + 1);
+    memset(payload, 0, l.total + 1); // Padding bytes are part of the checksum
+    if (rows > 0) {
+        memcpy(payload + l.scheduled_times, matches.scheduled_times, 8 * rows);
+        memcpy(payload + l.match_ids, matches.match_ids, 4 * rows);
+        memcpy(payload + l.group_ids, matches.group_ids, 4 * rows);
+        memcpy(payload + l.player1_ids, matches.player1_ids, 4 * rows);
+        memcpy(payload + l.player2_ids, matches.player2_ids, 4 * rows);
+        memcpy(payload + l.winner_ids, matches.winner_ids, 4 * rows);
+        memcpy(payload + l.scores, matches.scores, 4 * rows);
+        memcpy(payload + l.rounds, matches.rounds, rows);
+        memcpy(payload + l.stage_codes, matches.stage_codes, rows);
+        memcpy(payload + l.status_codes, matches.status_codes, rows);
+        if (file_version >= 2 && matches.time_formats) memcpy(payload + l.time_formats, matches.time_formats, rows);
+        else if (file_version >= 2) {
+            for (size_t i = 0; i < rows; i++)
+                payload[l.time_formats + i] = matches.scheduled_times[i] >= 0 ? Task4_MatchTable::TIME_SECONDS : Task4_MatchTable::TIME_UNKNOWN;
+        }
+    }
+    for (size_t i = 0; i < pc; i++) memcpy(payload + l.player_ids + 4 * i, &players[i].player_id, 4);
+    if (pc > 0) memcpy(payload + l.player_strings, player_strings, 16 * pc);
+    if (names > 0) memcpy(payload + l.name_offsets, name_offsets, 4 * names);
+    if (!strings.empty()) memcpy(payload + l.strings, strings.data(), strings.size());
+    task4_deleteArray(player_strings);
+    task4_deleteArray(name_offsets);
+
+    unsigned char header[TASK4_SEGMENT_HEADER_BYTES];
+    uint32_t fields[4] = {(uint32_t)season_id, (uint32_t)rows, (uint32_t)pc, (uint32_t)strings.size()};
+    uint16_t counts[2] = {(uint16_t)matches.stage_name_count, (uint16_t)matches.status_name_count};
+    uint64_t payload_bytes = l.total, checksum = task4_fnv1a64(payload, l.total);
+    memcpy(header, TASK4_SEGMENT_TAG, 4);
+    memcpy(header + 4, fields, 16);
+    memcpy(header + 20, counts, 4);
+    memcpy(header + 24, &payload_bytes, 8);
+    memcpy(header + 32, &checksum, 8);
+
+    // Earlier seasons are never rewritten: the new segment only goes after the existing bytes
+    FILE* f = fopen(path.c_str(), "ab");
+    bool ok = f != nullptr;
+    if (ok) {
+        fseek(f, 0, SEEK_END);
+        if (ftell(f) == 0) {
+            unsigned char file_header[TASK4_FILE_HEADER_BYTES] = {0};
+            uint32_t version = VERSION;
+            memcpy(file_header, TASK4_SNAPSHOT_MAGIC, 8);
+            memcpy(file_header + 8, &version, 4);
+            ok = fwrite(file_header, 1, sizeof(file_header), f) == sizeof(file_header);
+        }
+        ok = ok && fwrite(header, 1, sizeof(header), f) == sizeof(header);
+        ok = ok && fwrite(payload, 1, l.total, f) == l.total;
+        ok = (fclose(f) == 0) && ok;
+        if (ok) APUEC_COUNT_BYTES_WRITTEN((long long)(sizeof(header) + l.total));
+    }
+    task4_deleteArray(payload);
+    if (!ok) std::cerr << "Task 4 Warning: Could not append season " << season_id << " to '" << path << "'." << std::endl;
+    return ok;
+}
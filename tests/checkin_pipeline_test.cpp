@@ -0,0 +1,81 @@
+// Task2_CheckInPipeline as the Task 2 check-in desk uses it: check-ins left in the log by a
+// desk that never closed are recovered at start(), concurrent desks are applied exactly
+// once, and stop() leaves everything in the registry CSV with the log emptied.
+//
+// Built by the CMake project as checkin_pipeline_test.
+
+#include "../EsportsChampionship.hpp"
+#include <thread>
+
+static const char* const TEST_CSV = "Player_Registration.csv";
+static const int PLAYERS = 400;
+static const int DESKS = 8;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) { std::cerr << "FAILED: " << what << std::endl; failures++; }
+}
+
+static int countCheckedIn(struct Task2_PriorityQueue* pq) {
+    struct Task2_Queue* const queues[5] = {&pq->earlyBirdQueue, &pq->wildcardQueue, &pq->standardQueue,
+                                           &pq->lastMinuteQueue, &pq->waitlistQueue};
+    int count = 0;
+    for (int q = 0; q < 5; q++) {
+        for (struct Task2_Player* p = queues[q]->front; p; p = p->next) count += p->checkInStatus ? 1 : 0;
+    }
+    return count;
+}
+
+int main() {
+    struct Task2_PriorityQueue registry;
+    registry.init();
+    for (int i = 0; i < PLAYERS; i++) Task2_addPlayer(&registry, 1001 + i, "Desk Player", "Standard", "N/A");
+    check(Task2_writePlayersToCSV(&registry, TEST_CSV), "write the registry CSV");
+
+    // A desk that crashed: one complete entry and a torn last line.
+    FILE* log = fopen(TASK2_CHECKIN_LOG, "w");
+    if (!log) { std::cerr << "Cannot write " << TASK2_CHECKIN_LOG << std::endl; return 1; }
+    fputs("1001,2025-05-18 09:00:00\n1002,2025-05", log);
+    fclose(log);
+
+    Task2_CheckInPipeline desk(1024, 50);
+    check(desk.start(&registry, TEST_CSV, TASK2_CHECKIN_LOG), "start");
+    check(countCheckedIn(&registry) == 1, "the complete log entry is recovered, the torn one is not");
+
+    // Every desk scans every player (so all but one scan of each is a duplicate) and one unknown ID.
+    std::thread desks[DESKS];
+    for (int d = 0; d < DESKS; d++) {
+        desks[d] = std::thread([&desk, d]() {
+            char id[16];
+            for (int i = 0; i < PLAYERS; i++) {
+                snprintf(id, sizeof(id), "%d", 1001 + (i + d * 37) % PLAYERS);
+                while (!desk.submit(id)) std::this_thread::yield();
+            }
+            while (!desk.submit("9999")) std::this_thread::yield();
+        });
+    }
+    for (int d = 0; d < DESKS; d++) desks[d].join();
+    desk.stop();
+
+    check(desk.applied() == PLAYERS - 1, "each player not yet checked in is applied once");
+    check(desk.duplicates() == (long long)DESKS * PLAYERS - (PLAYERS - 1), "every other scan is a duplicate");
+    check(desk.unknown() == DESKS, "unknown IDs are counted");
+    check(countCheckedIn(&registry) == PLAYERS, "every player is checked in");
+    check(!desk.submit("1001"), "submit after stop() is refused");
+
+    FILE* left = fopen(TASK2_CHECKIN_LOG, "rb");
+    long log_bytes = 0;
+    if (left) { fseek(left, 0, SEEK_END); log_bytes = ftell(left); fclose(left); }
+    check(log_bytes == 0, "the log is empty once the CSV holds every check-in");
+
+    struct Task2_PriorityQueue reloaded;
+    reloaded.init();
+    Task2_readPlayersFromCSV(&reloaded, TEST_CSV);
+    check(countCheckedIn(&reloaded) == PLAYERS, "the saved CSV has every check-in");
+
+    Task2_destroyRegistry(&reloaded);
+    Task2_destroyRegistry(&registry);
+    if (failures == 0) std::cout << "checkin_pipeline_test passed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
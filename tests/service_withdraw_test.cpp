@@ -0,0 +1,94 @@
+// Service mode: a withdrawal must take the player out of the tournament too, so the
+// next POST /schedule cannot put them in a match. Runs the real event loop on a
+// thread in the working directory ctest gives it, and talks to it over HTTP.
+//
+// Linux only, like the service mode. Built by the CMake project as service_withdraw_test.
+
+#include "../EsportsChampionship.hpp"
+#include <thread>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <csignal>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) { std::cerr << "FAILED: " << what << std::endl; failures++; }
+}
+
+// One request on its own connection (Connection: close); returns the status, body in `body`.
+static int request(int port, const char* method, const char* path, const std::string& json, std::string& body) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+    if (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) { close(fd); return -1; }
+    std::string out = std::string(method) + " " + path + " HTTP/1.1\r\nConnection: close\r\nContent-Length: " +
+                      std::to_string(json.size()) + "\r\n\r\n" + json;
+    send(fd, out.data(), out.size(), MSG_NOSIGNAL);
+    std::string in;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = recv(fd, buffer, sizeof(buffer), 0)) > 0) in.append(buffer, (size_t)n);
+    close(fd);
+    size_t header_end = in.find("\r\n\r\n");
+    body = header_end == std::string::npos ? std::string() : in.substr(header_end + 4);
+    return in.size() > 12 ? atoi(in.c_str() + 9) : -1;
+}
+
+static int post(int port, const char* path, const std::string& json) {
+    std::string body;
+    return request(port, "POST", path, json, body);
+}
+
+int main() {
+    // A fresh tournament in the working directory.
+    const char* const leftovers[] = {TASK1_CHECKPOINT_FILE, TASK1_JOURNAL_FILE, "matches.csv", "brackets.csv"};
+    for (const char* file : leftovers) remove(file);
+    FILE* registration = fopen("Player_Registration.csv", "w");
+    if (!registration) { std::cerr << "Cannot write Player_Registration.csv" << std::endl; return 1; }
+    fputs("Player ID,Player Name,Registration Type,Email,Rank,Check-In,Time of Check-In,Status\n", registration);
+    fclose(registration);
+
+    ServiceOptions options;
+    options.port = 20000 + (int)(getpid() % 20000);
+    std::thread server([&options]() { runServiceMode(options); });
+    std::string body;
+    for (int i = 0; i < 50 && request(options.port, "GET", "/stats", "", body) < 0; i++) usleep(100 * 1000);
+
+    for (int i = 1; i <= 5; i++) {
+        check(post(options.port, "/register", "{\"name\":\"Player " + std::to_string(i) + "\",\"type\":\"Standard\"}") == 201, "register");
+    }
+    for (int id = 1001; id <= 1004; id++) {
+        check(post(options.port, "/checkin", "{\"player_id\":\"" + std::to_string(id) + "\"}") == 200, "check in");
+    }
+    check(post(options.port, "/withdraw", "{\"player_id\":\"1004\"}") == 200, "withdraw 1004");
+    check(post(options.port, "/schedule", "") == 409, "schedule with three players checked in is refused");
+
+    check(post(options.port, "/checkin", "{\"player_id\":\"1005\"}") == 200, "check in 1005");
+    check(post(options.port, "/schedule", "") == 201, "schedule with four players checked in");
+    check(request(options.port, "GET", "/matches", "", body) == 200, "list matches");
+    check(body.find("\"player1_id\":1005") != std::string::npos || body.find("\"player2_id\":1005") != std::string::npos, "1005 plays");
+    check(body.find("1004") == std::string::npos, "withdrawn 1004 is in no match");
+    check(post(options.port, "/withdraw", "{\"player_id\":\"1001\"}") == 409, "withdrawal after scheduling is refused");
+
+    kill(getpid(), SIGTERM); // runServiceMode's handler ends the loop within a second
+    server.join();
+    if (failures == 0) std::cout << "service_withdraw_test passed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
+
+#else
+
+int main() {
+    std::cout << "service_withdraw_test needs the Linux service mode; skipped." << std::endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,525 @@
+// Synthetic tournament dataset generator for load testing.
+// Writes Player_Registration.csv, matches.csv, brackets.csv and spectators.csv
+// in the layouts the system itself writes (Task 2, Tournament::saveMatchesToCSV,
+// Tournament::saveBracketsToCSV and Task3::SpectatorList::saveToCSV), at any scale.
+// The files describe one consistent tournament:
+//   - Registrations follow a fixed mix of types; rank follows the type as in Task 2.
+//     The last registrants go to the waitlist.
+//   - Check-in rates depend on the type. Check-in times cluster on the morning of
+//     day one, and Early-Bird players arrive first.
+//   - Checked-in players are grouped in fours by rank and type, in check-in
+//     order, as Tournament::groupPlayersByRank does. Each group plays two
+//     semifinals and a group final.
+//   - Group winners meet in single-elimination knockout rounds (byes for odd
+//     counts) and a final.
+//   - Winners come from hidden Elo ratings. Scores are round based: first to 13,
+//     win by two in overtime.
+//   - Spectators mostly support the stronger players.
+// Output depends only on the flags, so a seed names a dataset.
+//
+// Usage: apuec_datagen [--players=N] [--spectators=N] [--seed=S] [--start=YYYY-MM-DD]
+//                      [--stations=N] [--progress=PCT] [--waitlist=PCT] [--out=DIR]
+//   --stations  matches played at once (default: enough for a group round to fit in one day)
+//   --progress  share of scheduled matches already played (default 100); later
+//               rounds only appear once the matches feeding them are complete
+//   --waitlist  share of registrations on the waitlist (default 5)
+//   --out       existing directory for the four files (default .)
+//
+// Built by the CMake project as apuec_datagen, or from the repository root:
+//   g++ -std=c++17 -O2 tools/datagen.cpp src/BufferedWriter.cpp -o apuec_datagen
+
+#include "../EsportsChampionship.hpp"
+#include <cmath>
+
+// -------- Random numbers --------
+// xorshift64*; every file draws from its own stream, so changing one count
+// (say --spectators) leaves the other files unchanged.
+struct GenRng {
+    uint64_t state;
+    explicit GenRng(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL + 0x2545F4914F6CDD1DULL) { if (!state) state = 1; }
+    uint64_t next() {
+        state ^= state >> 12; state ^= state << 25; state ^= state >> 27;
+        return state * 2685821657736338717ULL;
+    }
+    int below(int n) { return (int)(next() % (uint64_t)n); }
+    double uniform() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+    double normal() { // Irwin-Hall approximation, plenty for test data
+        double sum = 0;
+        for (int i = 0; i < 12; i++) sum += uniform();
+        return sum - 6.0;
+    }
+};
+
+// -------- Calendar --------
+// Days since 1970-01-01 <-> civil date (Howard Hinnant's algorithms).
+static long long genDaysFromCivil(int y, int m, int d) {
+    y -= m <= 2;
+    long long era = (y >= 0 ? y : y - 399) / 400;
+    unsigned yoe = (unsigned)(y - era * 400);
+    unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (long long)doe - 719468;
+}
+
+static void genCivilFromDays(long long z, int& y, int& m, int& d) {
+    z += 719468;
+    long long era = (z >= 0 ? z : z - 146096) / 146097;
+    unsigned doe = (unsigned)(z - era * 146097);
+    unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    unsigned mp = (5 * doy + 2) / 153;
+    d = (int)(doy - (153 * mp + 2) / 5 + 1);
+    m = (int)(mp < 10 ? mp + 3 : mp - 9);
+    y = (int)(yoe + era * 400) + (m <= 2);
+}
+
+// Minutes since the epoch -> "YYYY-MM-DD HH:MM" or, with seconds, "YYYY-MM-DD HH:MM:SS".
+static void genFormatMinutes(long long minutes, int seconds, char* buf, size_t size) {
+    int y, m, d;
+    genCivilFromDays(minutes / 1440, y, m, d);
+    int hh = (int)(minutes % 1440) / 60, mm = (int)(minutes % 60);
+    if (seconds < 0) snprintf(buf, size, "%04d-%02d-%02d %02d:%02d", y, m, d, hh, mm);
+    else snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d", y, m, d, hh, mm, seconds);
+}
+
+// -------- Players --------
+static const char* const GEN_REG_TYPES[4] = {"Early-Bird", "Wildcard", "Standard", "Last-Minute"};
+static const char* const GEN_RANKS[4] = {"A", "B", "C", "D"}; // Task 2 derives rank from the type
+static const int GEN_TYPE_SHARE[4] = {20, 10, 55, 15};         // percent of registrations
+static const int GEN_CHECK_IN_RATE[4] = {95, 90, 85, 75};      // percent who turn up
+static const int GEN_ARRIVAL_OFFSET[4] = {-35, -20, 0, 25};    // minutes around the 08:30 peak
+
+static const char* const GEN_FIRST_NAMES[32] = {
+    "Aisha", "Ahmad", "Ben", "Chen", "Daniel", "Devi", "Emily", "Farah", "Gabriel", "Hana", "Ivan", "Julia",
+    "Kavya", "Lucas", "Maria", "Mei", "Nabil", "Olivia", "Priya", "Quinn", "Rahul", "Sara", "Tariq", "Uma",
+    "Victor", "Wei", "Xin", "Yusuf", "Zara", "Arjun", "Nurul", "Kenji"};
+static const char* const GEN_LAST_NAMES[32] = {
+    "Abdullah", "Anderson", "Chan", "Das", "Fernandez", "Goh", "Hassan", "Ibrahim", "James", "Johnson", "Kim",
+    "Kumar", "Lee", "Lim", "Martin", "Nair", "Ng", "Ong", "Patel", "Rahman", "Rao", "Singh", "Smith", "Tan",
+    "Teo", "Wong", "Yap", "Zhang", "Ismail", "Lopez", "Chua", "Menon"};
+static const char* const GEN_MAIL_DOMAINS[4] = {"gmail.com", "yahoo.com", "hotmail.com", "mail.apu.edu.my"};
+
+struct GenPlayer {
+    int id;
+    int first, last, domain; // name and mail list indexes
+    int type;                // index into GEN_REG_TYPES
+    bool waitlisted;
+    bool checked_in;
+    long long check_in_minute;
+    int check_in_second;
+    double skill; // hidden Elo rating
+    int group_id; // 0 when not placed in a group
+    int group_status; // 0 active, 1 won the group, 2 eliminated
+};
+
+// -------- Matches --------
+enum { GEN_STAGE_GROUP, GEN_STAGE_KNOCKOUT, GEN_STAGE_FINAL };
+static const char* const GEN_STAGE_NAMES[3] = {"group", "knockout", "final"};
+
+struct GenMatch {
+    int stage, group_id, round;
+    int p1, p2;           // player indexes, or -1 while decided by a feeder
+    int feed1, feed2;     // match whose winner takes the slot, -1 for a fixed player
+    long long minute;     // scheduled start
+    bool emitted;         // both players known, so the tournament has created it
+    bool completed;
+    int winner;           // player index
+    int score1, score2;
+};
+
+struct GenDataset {
+    GenPlayer* players;
+    int player_count;
+    GenMatch* matches;
+    int match_count;
+    int group_count;
+    int* group_first_match; // group g's three matches start here
+};
+
+static void genPlayers(GenDataset& ds, uint64_t seed, int waitlist_pct, long long day_one) {
+    GenRng rng(seed ^ 0x504C41594552ULL);
+    int main_count = ds.player_count - (int)((long long)ds.player_count * waitlist_pct / 100);
+    for (int i = 0; i < ds.player_count; i++) {
+        GenPlayer& p = ds.players[i];
+        p.id = 1001 + i;
+        p.first = rng.below(32); p.last = rng.below(32); p.domain = rng.below(4);
+        int r = rng.below(100), type = 0;
+        while (type < 3 && r >= GEN_TYPE_SHARE[type]) r -= GEN_TYPE_SHARE[type++];
+        p.type = type;
+        p.waitlisted = i >= main_count;
+        p.checked_in = !p.waitlisted && rng.below(100) < GEN_CHECK_IN_RATE[type];
+        double arrival = 8 * 60 + 30 + GEN_ARRIVAL_OFFSET[type] + 20 * rng.normal();
+        if (arrival < 7 * 60) arrival = 7 * 60;
+        if (arrival > 10 * 60 + 59) arrival = 10 * 60 + 59;
+        p.check_in_minute = day_one * 1440 + (long long)arrival;
+        p.check_in_second = rng.below(60);
+        p.skill = 1500 + 200 * rng.normal() + (3 - type) * 25; // early registrants are slightly stronger on average
+        p.group_id = 0;
+        p.group_status = 0;
+    }
+}
+
+// Checked-in main-list players in check-in order, then grouped in fours within each
+// rank/type category like Tournament::groupPlayersByRank (the remainder of a category sits out).
+static void genGroups(GenDataset& ds) {
+    int* order = new int[ds.player_count];
+    int count = 0;
+    for (int i = 0; i < ds.player_count; i++) if (ds.players[i].checked_in) order[count++] = i;
+    const GenPlayer* players = ds.players;
+    std::sort(order, order + count, [players](int a, int b) {
+        long long ta = players[a].check_in_minute * 60 + players[a].check_in_second;
+        long long tb = players[b].check_in_minute * 60 + players[b].check_in_second;
+        return ta != tb ? ta < tb : a < b;
+    });
+
+    int groups = 0;
+    int* pending = new int[4 * 4]; // up to three waiting players per category
+    int pending_count[4] = {0, 0, 0, 0};
+    ds.matches = new GenMatch[count + 1]; // 3 per group of 4, plus at most one per group winner
+    ds.group_first_match = new int[count / 4 + 1];
+    ds.match_count = 0;
+    for (int k = 0; k < count; k++) {
+        int type = ds.players[order[k]].type;
+        pending[type * 4 + pending_count[type]++] = order[k];
+        if (pending_count[type] < 4) continue;
+        pending_count[type] = 0;
+        int group_id = ++groups;
+        int* four = &pending[type * 4];
+        for (int j = 0; j < 4; j++) ds.players[four[j]].group_id = group_id;
+        ds.group_first_match[group_id - 1] = ds.match_count;
+        for (int j = 0; j < 3; j++) {
+            GenMatch& m = ds.matches[ds.match_count + j];
+            m.stage = GEN_STAGE_GROUP; m.group_id = group_id; m.round = j < 2 ? 1 : 2;
+            m.p1 = j < 2 ? four[2 * j] : -1;
+            m.p2 = j < 2 ? four[2 * j + 1] : -1;
+            m.feed1 = j < 2 ? -1 : ds.match_count;
+            m.feed2 = j < 2 ? -1 : ds.match_count + 1;
+        }
+        ds.match_count += 3;
+    }
+    ds.group_count = groups;
+    delete[] pending;
+    delete[] order;
+}
+
+// Group winners (the group finals) pair off round by round; an odd entrant gets a bye.
+// The last two meet in the final.
+static void genKnockout(GenDataset& ds) {
+    int entrants = ds.group_count;
+    if (entrants < 2) return;
+    int* feeders = new int[entrants];
+    for (int g = 0; g < entrants; g++) feeders[g] = ds.group_first_match[g] + 2;
+    int round = 1;
+    while (entrants > 1) {
+        int next = 0;
+        for (int j = 0; j + 1 < entrants; j += 2) {
+            GenMatch& m = ds.matches[ds.match_count];
+            m.stage = entrants == 2 ? GEN_STAGE_FINAL : GEN_STAGE_KNOCKOUT;
+            m.group_id = 0; m.round = entrants == 2 ? 1 : round;
+            m.p1 = m.p2 = -1;
+            m.feed1 = feeders[j]; m.feed2 = feeders[j + 1];
+            feeders[next++] = ds.match_count++;
+        }
+        if (entrants % 2) feeders[next++] = feeders[entrants - 1];
+        entrants = next;
+        round++;
+    }
+    delete[] feeders;
+}
+
+// Matches are created in waves: group round 1, group round 2, each knockout round, the
+// final. A wave starts on the hour after the previous one ends; stations play in parallel
+// between 09:00 and 21:00, rolling over to the next morning.
+static long long genOpenSlot(long long minute) {
+    return minute % 1440 >= 21 * 60 ? (minute / 1440 + 1) * 1440 + 9 * 60 : minute;
+}
+
+static void genScheduleWave(GenDataset& ds, int stage, int round, int stations, long long& slot) {
+    int on_slot = 0;
+    for (int i = 0; i < ds.match_count; i++) {
+        GenMatch& m = ds.matches[i];
+        bool in_wave = stage == GEN_STAGE_GROUP ? m.stage == GEN_STAGE_GROUP && m.round == round
+                                                : m.stage != GEN_STAGE_GROUP && m.stage == stage && m.round == round;
+        if (!in_wave) continue;
+        if (on_slot == stations) { on_slot = 0; slot = genOpenSlot(slot + 60); }
+        m.minute = slot;
+        on_slot++;
+    }
+    if (on_slot > 0) slot = genOpenSlot(slot + 60);
+}
+
+static void genSchedule(GenDataset& ds, long long day_one, int stations) {
+    long long slot = day_one * 1440 + 11 * 60; // check-in closes at 11:00 on day one
+    genScheduleWave(ds, GEN_STAGE_GROUP, 1, stations, slot);
+    genScheduleWave(ds, GEN_STAGE_GROUP, 2, stations, slot);
+    int rounds = 0;
+    for (int i = 0; i < ds.match_count; i++)
+        if (ds.matches[i].stage == GEN_STAGE_KNOCKOUT && ds.matches[i].round > rounds) rounds = ds.matches[i].round;
+    for (int round = 1; round <= rounds; round++) genScheduleWave(ds, GEN_STAGE_KNOCKOUT, round, stations, slot);
+    genScheduleWave(ds, GEN_STAGE_FINAL, 1, stations, slot);
+}
+
+// Plays matches in schedule order until the requested share is complete.
+static void genPlay(GenDataset& ds, uint64_t seed, int progress_pct) {
+    GenRng rng(seed ^ 0x4D41544348ULL);
+    long long to_complete = (long long)ds.match_count * progress_pct / 100;
+    long long completed = 0;
+    // Group rounds were scheduled round by round, so play group matches in that order too.
+    for (int pass = 0; pass < 3; pass++) {
+        for (int i = 0; i < ds.match_count; i++) {
+            GenMatch& m = ds.matches[i];
+            int want = m.stage != GEN_STAGE_GROUP ? 2 : m.round - 1;
+            if (want != pass) continue;
+            m.emitted = false; m.completed = false; m.winner = -1; m.score1 = m.score2 = 0;
+            if (m.feed1 >= 0) m.p1 = ds.matches[m.feed1].completed ? ds.matches[m.feed1].winner : -1;
+            if (m.feed2 >= 0) m.p2 = ds.matches[m.feed2].completed ? ds.matches[m.feed2].winner : -1;
+            if (m.p1 < 0 || m.p2 < 0) continue;
+            m.emitted = true;
+            if (completed >= to_complete) continue;
+            completed++;
+            m.completed = true;
+            double expected = 1.0 / (1.0 + pow(10.0, (ds.players[m.p2].skill - ds.players[m.p1].skill) / 400.0));
+            bool p1_wins = rng.uniform() < expected;
+            m.winner = p1_wins ? m.p1 : m.p2;
+            // Closer ratings give closer scores; 12 rounds for the loser goes to overtime.
+            double closeness = 1.0 - 2.0 * fabs(expected - 0.5);
+            int loser = (int)(13 * closeness * rng.uniform() + 13 * closeness * rng.uniform()) / 2 + rng.below(4);
+            if (loser > 12) loser = 12;
+            int winner = 13;
+            if (loser == 12) {
+                winner = 14;
+                while (rng.below(100) < 35) { winner += 2; loser += 2; }
+            }
+            m.score1 = p1_wins ? winner : loser;
+            m.score2 = p1_wins ? loser : winner;
+        }
+    }
+    for (int g = 0; g < ds.group_count; g++) {
+        const GenMatch& final_match = ds.matches[ds.group_first_match[g] + 2];
+        if (!final_match.completed) continue;
+        for (int i = 0; i < 2; i++) {
+            const GenMatch& semi = ds.matches[ds.group_first_match[g] + i];
+            ds.players[semi.p1].group_status = semi.p1 == final_match.winner ? 1 : 2;
+            ds.players[semi.p2].group_status = semi.p2 == final_match.winner ? 1 : 2;
+        }
+    }
+}
+
+// -------- Output --------
+static void genWriteName(BufferedWriter& out, const GenPlayer& p) {
+    out.write(GEN_FIRST_NAMES[p.first]); out.put(' '); out.write(GEN_LAST_NAMES[p.last]);
+}
+
+static bool genWritePlayers(const GenDataset& ds, const char* path) {
+    BufferedWriter out;
+    if (!out.open(path)) return false;
+    out.write("Player ID,Player Name,Registration Type,Email,Rank,Check-In,Time of Check-In,Status\n");
+    char when[32];
+    for (int i = 0; i < ds.player_count; i++) {
+        const GenPlayer& p = ds.players[i];
+        out.writeInt(p.id); out.put(',');
+        genWriteName(out, p); out.put(',');
+        out.write(GEN_REG_TYPES[p.type]); out.put(',');
+        for (const char* c = GEN_FIRST_NAMES[p.first]; *c; c++) out.put((char)tolower((unsigned char)*c));
+        out.put('.');
+        for (const char* c = GEN_LAST_NAMES[p.last]; *c; c++) out.put((char)tolower((unsigned char)*c));
+        out.writeInt(p.id); out.put('@'); out.write(GEN_MAIL_DOMAINS[p.domain]); out.put(',');
+        out.write(GEN_RANKS[p.type]); out.put(',');
+        if (p.checked_in) {
+            genFormatMinutes(p.check_in_minute, p.check_in_second, when, sizeof(when));
+            out.write("YES,"); out.write(when);
+        } else {
+            out.write("NO,N/A");
+        }
+        out.write(p.waitlisted ? ",WAITLIST\n" : ",MAIN\n");
+    }
+    return out.close();
+}
+
+// Same columns and conventions as Tournament::saveMatchesToCSV: ids in creation order,
+// group_id 0 outside the group stage, winner 0 and score "0-0" until played.
+static bool genWriteMatches(const GenDataset& ds, const char* path) {
+    BufferedWriter out;
+    if (!out.open(path)) return false;
+    out.write("match_id,stage,group_id,round,player1_id,player2_id,scheduled_time,status,winner_id,score\n");
+    char when[32];
+    int next_id = 1;
+    for (int pass = 0; pass < 3; pass++) { // creation order: group round 1, group round 2, knockout
+        for (int i = 0; i < ds.match_count; i++) {
+            const GenMatch& m = ds.matches[i];
+            int want = m.stage != GEN_STAGE_GROUP ? 2 : m.round - 1;
+            if (want != pass || !m.emitted) continue;
+            genFormatMinutes(m.minute, -1, when, sizeof(when));
+            out.writeInt(next_id++); out.put(',');
+            out.write(GEN_STAGE_NAMES[m.stage]); out.put(',');
+            out.writeInt(m.group_id); out.put(',');
+            out.writeInt(m.round); out.put(',');
+            out.writeInt(ds.players[m.p1].id); out.put(',');
+            out.writeInt(ds.players[m.p2].id); out.put(',');
+            out.write(when); out.put(',');
+            out.write(m.completed ? "completed," : "scheduled,");
+            out.writeInt(m.completed ? ds.players[m.winner].id : 0); out.put(',');
+            out.writeInt(m.score1); out.put('-'); out.writeInt(m.score2); out.put('\n');
+        }
+    }
+    return out.close();
+}
+
+static void genBracketRow(BufferedWriter& out, int& bracket_id, const char* stage, const GenPlayer& p,
+                          int group_id, const char* status) {
+    out.writeInt(bracket_id++); out.put(',');
+    out.write(stage); out.put(',');
+    out.writeInt(p.id); out.put(',');
+    genWriteName(out, p); out.put(',');
+    out.writeInt(group_id); out.put(',');
+    out.write(GEN_RANKS[p.type]); out.put(',');
+    out.write(status); out.put('\n');
+}
+
+// Same rows as Tournament::saveBracketsToCSV: every group member, the group winners
+// that qualified, then both players of each knockout and final match.
+static bool genWriteBrackets(const GenDataset& ds, const char* path) {
+    static const char* const group_status[3] = {"active_group", "won_group", "eliminated_group"};
+    BufferedWriter out;
+    if (!out.open(path)) return false;
+    out.write("bracket_id,stage,player_id,player_name,group_id,rank,status_in_stage\n");
+    int bracket_id = 1;
+    for (int g = 0; g < ds.group_count; g++) {
+        for (int i = 0; i < 2; i++) {
+            const GenMatch& semi = ds.matches[ds.group_first_match[g] + i];
+            genBracketRow(out, bracket_id, "group", ds.players[semi.p1], g + 1, group_status[ds.players[semi.p1].group_status]);
+            genBracketRow(out, bracket_id, "group", ds.players[semi.p2], g + 1, group_status[ds.players[semi.p2].group_status]);
+        }
+    }
+    for (int g = 0; g < ds.group_count; g++) {
+        const GenMatch& final_match = ds.matches[ds.group_first_match[g] + 2];
+        if (final_match.completed)
+            genBracketRow(out, bracket_id, "knockout_qualifier", ds.players[final_match.winner], g + 1, "advanced_to_knockout");
+    }
+    for (int i = ds.group_count * 3; i < ds.match_count; i++) {
+        const GenMatch& m = ds.matches[i];
+        if (!m.emitted) continue;
+        const char* stage = GEN_STAGE_NAMES[m.stage];
+        genBracketRow(out, bracket_id, stage, ds.players[m.p1], 0,
+                      m.completed ? (m.winner == m.p1 ? "won_match" : "lost_match") : "active_knockout");
+        genBracketRow(out, bracket_id, stage, ds.players[m.p2], 0,
+                      m.completed ? (m.winner == m.p2 ? "won_match" : "lost_match") : "active_knockout");
+    }
+    return out.close();
+}
+
+// Spectators pick a tournament day and mostly back the stronger players: the supported
+// player is drawn from the skill ranking with a quadratic bias towards the top.
+static bool genWriteSpectators(const GenDataset& ds, uint64_t seed, int count, long long day_one,
+                               int days, const char* path) {
+    GenRng rng(seed ^ 0x53504543ULL);
+    int* by_skill = new int[ds.player_count];
+    for (int i = 0; i < ds.player_count; i++) by_skill[i] = i;
+    const GenPlayer* players = ds.players;
+    std::sort(by_skill, by_skill + ds.player_count, [players](int a, int b) {
+        return players[a].skill != players[b].skill ? players[a].skill > players[b].skill : a < b;
+    });
+
+    BufferedWriter out;
+    bool ok = out.open(path);
+    if (ok) {
+        out.write("spectator_id,name,category,wants_live_stream,supported_player,day,payment_amount\n");
+        char id[24], day[16];
+        for (int i = 0; i < count; i++) {
+            int r = rng.below(100);
+            const char* category = r < 8 ? "VIP" : r < 20 ? "Influencer" : "General";
+            int payment = r < 8 ? 500 : r < 20 ? 350 : 200; // Spectator::assignPaymentAmount
+            bool stream = rng.below(100) < (r >= 8 && r < 20 ? 90 : 55);
+            double u = rng.uniform();
+            int supported = ds.player_count > 0 ? by_skill[(int)(u * u * ds.player_count)] : -1;
+            int y, m, d;
+            genCivilFromDays(day_one + rng.below(days), y, m, d);
+            snprintf(day, sizeof(day), "%04d-%02d-%02d", y, m, d);
+            snprintf(id, sizeof(id), "S%02d", i + 1);
+            out.write(id); out.put(',');
+            out.write(GEN_FIRST_NAMES[rng.below(32)]); out.put(' '); out.write(GEN_LAST_NAMES[rng.below(32)]); out.put(',');
+            out.write(category); out.put(',');
+            out.write(stream ? "Yes," : "No,");
+            if (supported >= 0) out.writeInt(ds.players[supported].id);
+            out.put(',');
+            out.write(day); out.put(',');
+            out.writeInt(payment); out.put('\n');
+        }
+        ok = out.close();
+    }
+    delete[] by_skill;
+    return ok;
+}
+
+static bool genFlag(const char* arg, const char* name, const char*& value) {
+    size_t n = strlen(name);
+    if (strncmp(arg, name, n) != 0 || arg[n] != '=') return false;
+    value = arg + n + 1;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    long long players = 1000, spectators = -1, seed = 1;
+    int stations = 0, progress = 100, waitlist = 5;
+    int year = 2025, month = 5, day = 20;
+    const char* out_dir = ".";
+    for (int i = 1; i < argc; i++) {
+        const char* v;
+        if (genFlag(argv[i], "--players", v)) players = atoll(v);
+        else if (genFlag(argv[i], "--spectators", v)) spectators = atoll(v);
+        else if (genFlag(argv[i], "--seed", v)) seed = atoll(v);
+        else if (genFlag(argv[i], "--stations", v)) stations = atoi(v);
+        else if (genFlag(argv[i], "--progress", v)) progress = atoi(v);
+        else if (genFlag(argv[i], "--waitlist", v)) waitlist = atoi(v);
+        else if (genFlag(argv[i], "--out", v)) out_dir = v;
+        else if (genFlag(argv[i], "--start", v) && sscanf(v, "%d-%d-%d", &year, &month, &day) == 3) {}
+        else {
+            fprintf(stderr, "Usage: %s [--players=N] [--spectators=N] [--seed=S] [--start=YYYY-MM-DD]\n"
+                            "       [--stations=N] [--progress=PCT] [--waitlist=PCT] [--out=DIR]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (players < 0 || players > 100000000 || stations < 0 || progress < 0 || progress > 100 || waitlist < 0 || waitlist > 100) {
+        fprintf(stderr, "Out of range: players 0..1e8, stations >= 0, progress and waitlist 0..100.\n");
+        return 1;
+    }
+    if (spectators < 0) spectators = players * 3;
+
+    GenDataset ds;
+    ds.player_count = (int)players;
+    ds.players = new GenPlayer[ds.player_count > 0 ? ds.player_count : 1];
+    long long day_one = genDaysFromCivil(year, month, day);
+    genPlayers(ds, (uint64_t)seed, waitlist, day_one);
+    genGroups(ds);
+    genKnockout(ds);
+    if (stations == 0) stations = ds.group_count * 2 / 10 + 1 > 8 ? ds.group_count * 2 / 10 + 1 : 8; // 10 hourly slots a day
+    genSchedule(ds, day_one, stations);
+    genPlay(ds, (uint64_t)seed, progress);
+    int days = 1;
+    for (int i = 0; i < ds.match_count; i++) {
+        int span = (int)(ds.matches[i].minute / 1440 - day_one) + 1;
+        if (span > days) days = span;
+    }
+
+    char path[1024];
+    bool ok = true;
+    snprintf(path, sizeof(path), "%s/Player_Registration.csv", out_dir);
+    ok = genWritePlayers(ds, path) && ok;
+    snprintf(path, sizeof(path), "%s/matches.csv", out_dir);
+    ok = genWriteMatches(ds, path) && ok;
+    snprintf(path, sizeof(path), "%s/brackets.csv", out_dir);
+    ok = genWriteBrackets(ds, path) && ok;
+    snprintf(path, sizeof(path), "%s/spectators.csv", out_dir);
+    ok = genWriteSpectators(ds, (uint64_t)seed, (int)spectators, day_one, days, path) && ok;
+
+    int emitted = 0, completed = 0;
+    for (int i = 0; i < ds.match_count; i++) { emitted += ds.matches[i].emitted; completed += ds.matches[i].completed; }
+    if (ok) printf("Seed %lld: %d players, %d groups, %d matches (%d completed) over %d day(s), %lld spectators -> %s\n",
+                   seed, ds.player_count, ds.group_count, emitted, completed, days, spectators, out_dir);
+    else fprintf(stderr, "Could not write every file to '%s' (does the directory exist?)\n", out_dir);
+
+    delete[] ds.group_first_match;
+    delete[] ds.matches;
+    delete[] ds.players;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+// Load client for the service mode (EsportsChampionship --serve).
+// Opens N keep-alive connections, one thread each, and sends a fixed number of
+// requests in total, timing every round trip into one latency histogram.
+//   --mix=checkin  POST /checkin for random players in [first-player, first-player + player-count)
+//   --mix=stats    GET /stats, half of them for a single player
+//   --mix=mixed    half check-ins, half stats (default)
+// 404s (a player the registry or Task 4 does not know) count as answered, not as errors.
+// Exits non-zero if any request failed.
+//
+// Usage: apuec_loadclient [--host=ADDR] [--port=N] [--connections=N] [--requests=N]
+//                         [--mix=checkin|stats|mixed] [--first-player=ID] [--player-count=N] [--seed=S]
+//
+// Linux only, like the service mode. Built by the CMake project as apuec_loadclient.
+
+#include "../EsportsChampionship.hpp"
+#include <thread>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum LoadMix { LOAD_CHECKIN, LOAD_STATS, LOAD_MIXED };
+
+struct LoadConfig {
+    const char* host;
+    int port;
+    int connections;
+    long long requests;
+    LoadMix mix;
+    int first_player;
+    int player_count;
+    unsigned long long seed;
+};
+
+struct LoadCounters {
+    std::atomic<long long> ok;
+    std::atomic<long long> not_found;
+    std::atomic<long long> errors;
+};
+
+static int loadConnect(const LoadConfig& config) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)config.port);
+    if (inet_pton(AF_INET, config.host, &addr.sin_addr) != 1 || connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool loadSendAll(int fd, const char* data, size_t n) {
+    while (n > 0) {
+        ssize_t sent = send(fd, data, n, MSG_NOSIGNAL);
+        if (sent <= 0) return false;
+        data += sent;
+        n -= (size_t)sent;
+    }
+    return true;
+}
+
+// Reads one response off the connection; returns its status code, or -1 if the connection failed.
+// Bytes past the response stay in `pending` for the next call.
+static int loadReadResponse(int fd, std::string& pending) {
+    char buffer[8192];
+    while (true) {
+        size_t header_end = pending.find("\r\n\r\n");
+        if (header_end != std::string::npos) {
+            int status = pending.compare(0, 9, "HTTP/1.1 ") == 0 ? atoi(pending.c_str() + 9) : -1;
+            size_t length_at = pending.find("Content-Length: ");
+            if (status < 0 || length_at == std::string::npos || length_at > header_end) return -1;
+            size_t total = header_end + 4 + (size_t)atoll(pending.c_str() + length_at + 16);
+            if (pending.size() >= total) {
+                pending.erase(0, total);
+                return status;
+            }
+        }
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) return -1;
+        pending.append(buffer, (size_t)n);
+    }
+}
+
+static void loadBuildRequest(const LoadConfig& config, uint64_t& rng, std::string& request) {
+    rng ^= rng >> 12; rng ^= rng << 25; rng ^= rng >> 27; // xorshift64*
+    uint64_t r = rng * 2685821657736338717ULL;
+    int player = config.first_player + (int)((r >> 8) % (uint64_t)config.player_count);
+    bool checkin = config.mix == LOAD_CHECKIN || (config.mix == LOAD_MIXED && (r & 1));
+    char line[256];
+    if (checkin) {
+        char body[64];
+        int body_len = snprintf(body, sizeof(body), "{\"player_id\":\"%d\"}", player);
+        snprintf(line, sizeof(line), "POST /checkin HTTP/1.1\r\nHost: %s\r\nContent-Type: application/json\r\n"
+                 "Content-Length: %d\r\n\r\n%s", config.host, body_len, body);
+    } else if (r & 2) {
+        snprintf(line, sizeof(line), "GET /stats?player_id=%d HTTP/1.1\r\nHost: %s\r\n\r\n", player, config.host);
+    } else {
+        snprintf(line, sizeof(line), "GET /stats HTTP/1.1\r\nHost: %s\r\n\r\n", config.host);
+    }
+    request = line;
+}
+
+static void loadWorker(const LoadConfig& config, int index, long long requests, LatencyHistogram* latency,
+                       LoadCounters* counters) {
+    int fd = loadConnect(config);
+    if (fd < 0) {
+        counters->errors.fetch_add(requests, std::memory_order_relaxed);
+        return;
+    }
+    uint64_t rng = (config.seed + 1) * 0x9E3779B97F4A7C15ULL + (uint64_t)index * 0x2545F4914F6CDD1DULL;
+    if (!rng) rng = 1;
+    std::string request, pending;
+    for (long long i = 0; i < requests; i++) {
+        loadBuildRequest(config, rng, request);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int status = loadSendAll(fd, request.data(), request.size()) ? loadReadResponse(fd, pending) : -1;
+        latency->record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        if (status >= 200 && status < 300) counters->ok.fetch_add(1, std::memory_order_relaxed);
+        else if (status == 404) counters->not_found.fetch_add(1, std::memory_order_relaxed);
+        else counters->errors.fetch_add(1, std::memory_order_relaxed);
+        if (status < 0) { // The connection is gone; the rest of this worker's share fails too
+            counters->errors.fetch_add(requests - i - 1, std::memory_order_relaxed);
+            break;
+        }
+    }
+    close(fd);
+}
+
+static bool loadFlag(const char* arg, const char* name, const char*& value) {
+    size_t n = strlen(name);
+    if (strncmp(arg, name, n) != 0 || arg[n] != '=') return false;
+    value = arg + n + 1;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    LoadConfig config;
+    config.host = "127.0.0.1";
+    config.port = 8080;
+    config.connections = 16;
+    config.requests = 20000;
+    config.mix = LOAD_MIXED;
+    config.first_player = 1001;
+    config.player_count = 100;
+    config.seed = 1;
+    for (int i = 1; i < argc; i++) {
+        const char* v;
+        if (loadFlag(argv[i], "--host", v)) config.host = v;
+        else if (loadFlag(argv[i], "--port", v)) config.port = atoi(v);
+        else if (loadFlag(argv[i], "--connections", v)) config.connections = atoi(v);
+        else if (loadFlag(argv[i], "--requests", v)) config.requests = atoll(v);
+        else if (loadFlag(argv[i], "--first-player", v)) config.first_player = atoi(v);
+        else if (loadFlag(argv[i], "--player-count", v)) config.player_count = atoi(v);
+        else if (loadFlag(argv[i], "--seed", v)) config.seed = strtoull(v, nullptr, 10);
+        else if (loadFlag(argv[i], "--mix", v) && strcmp(v, "checkin") == 0) config.mix = LOAD_CHECKIN;
+        else if (loadFlag(argv[i], "--mix", v) && strcmp(v, "stats") == 0) config.mix = LOAD_STATS;
+        else if (loadFlag(argv[i], "--mix", v) && strcmp(v, "mixed") == 0) config.mix = LOAD_MIXED;
+        else {
+            fprintf(stderr, "Usage: %s [--host=ADDR] [--port=N] [--connections=N] [--requests=N]\n"
+                            "       [--mix=checkin|stats|mixed] [--first-player=ID] [--player-count=N] [--seed=S]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (config.port <= 0 || config.port > 65535 || config.connections <= 0 || config.connections > 4096 ||
+        config.requests <= 0 || config.player_count <= 0) {
+        fprintf(stderr, "Out of range: port 1..65535, connections 1..4096, requests and player-count > 0.\n");
+        return 1;
+    }
+
+    LatencyHistogram* latency = new LatencyHistogram(); // Too large for the stack
+    LoadCounters counters;
+    counters.ok = 0;
+    counters.not_found = 0;
+    counters.errors = 0;
+    std::thread* workers = new std::thread[config.connections];
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < config.connections; i++) {
+        long long share = config.requests / config.connections + (i < config.requests % config.connections ? 1 : 0);
+        workers[i] = std::thread(loadWorker, std::cref(config), i, share, latency, &counters);
+    }
+    for (int i = 0; i < config.connections; i++) workers[i].join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    delete[] workers;
+
+    long long ok = counters.ok.load(), not_found = counters.not_found.load(), errors = counters.errors.load();
+    printf("%lld requests over %d connections in %.3f s: %.0f req/s\n", ok + not_found + errors,
+           config.connections, seconds, seconds > 0 ? (ok + not_found) / seconds : 0.0);
+    printf("  ok %lld, not found %lld, errors %lld\n", ok, not_found, errors);
+    if (latency->count() > 0) {
+        printf("  latency us: p50 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n", latency->percentile(50) / 1000.0,
+               latency->percentile(99) / 1000.0, latency->percentile(99.9) / 1000.0, latency->max() / 1000.0);
+    }
+    delete latency;
+    return errors == 0 ? 0 : 1;
+}
+
+#else
+
+int main() {
+    fprintf(stderr, "apuec_loadclient drives the service mode, which is only available on Linux.\n");
+    return 1;
+}
+
+#endif